@@ -29,6 +29,9 @@
 // 서버 종료를 위한 전역 플래그 (Signal Handler에서 변경)
 volatile bool g_exit_flag = false;
 
+// Signal Handler 에서 Stop 을 호출하기 위한 서버 포인터 (Run 전에 설정)
+TcpServerContext* volatile g_server = NULL;
+
 // --------------------------------------------------------------------------
 // 2. ServiceContext 정의
 // --------------------------------------------------------------------------
@@ -55,7 +58,7 @@ typedef struct
 
 void HandleSignal( int sig );
 
-void OnClientMessage( TcpServerContext* ctx, int client_fd, void* service_ctx,
+void OnClientMessage( TcpServerContext* ctx, ConnHandle conn, void* service_ctx,
                       const char* target, const char* body, int len );
 
 
@@ -103,10 +106,12 @@ int main( int argc, char* argv[] )
     }
 
     // 6. 서버 루프 실행 (Blocking)
-    // g_exit_flag가 true가 될 때까지 내부 루프를 돕니다.
+    // Ctrl+C 시 HandleSignal 이 Stop 을 호출해 대기 중인 루프를 바로 깨웁니다.
+    g_server = server;
     server->Run( server, &g_exit_flag );
 
     // 7. 자원 해제 및 종료
+    g_server = NULL;
     server->Destroy( server );
 
     printf( "[Main] Server application terminated safely. Total Msgs: %ld\n",
@@ -122,12 +127,17 @@ int main( int argc, char* argv[] )
 
 /**
  * ## 시그널 핸들러
- * Ctrl+C (SIGINT) 입력 시 종료 플래그를 설정하여 서버 루프를 안전하게 멈춘다.
+ * Ctrl+C (SIGINT) 입력 시 Stop 으로 서버 루프를 깨워 안전하게 멈춘다.
+ * (Stop 은 eventfd 에 쓰기만 하므로 시그널 핸들러에서 호출해도 안전하다)
  */
 void HandleSignal( int sig )
 {
     printf( "\n[Main] Caught signal %d. Initiating graceful shutdown...\n", sig );
     g_exit_flag = true;
+
+    TcpServerContext* server = g_server;
+    if( server )
+        server->Stop( server );
 }
 
 /**
@@ -137,13 +147,13 @@ void HandleSignal( int sig )
  * 단일 워커 스레드 모델이므로 별도의 Mutex 없이 service_ctx에 안전하게 접근 가능하다.
  *
  * @param ctx         서버 라이브러리 컨텍스트 (Send, Broadcast 등 기능 제공)
- * @param client_fd   메시지를 보낸 클라이언트의 소켓 FD
+ * @param conn        메시지를 보낸 연결의 핸들 (응답 시 Send에 그대로 전달)
  * @param service_ctx 사용자가 등록한 애플리케이션 데이터 (ChatServiceContext)
  * @param target      패킷 타겟 코드 (AppProtocol.h 의 상수 사용 권장)
  * @param body        복호화된 바디 데이터 포인터
  * @param len         바디 데이터 길이
  */
-void OnClientMessage( TcpServerContext* ctx, int client_fd, void* service_ctx,
+void OnClientMessage( TcpServerContext* ctx, ConnHandle conn, void* service_ctx,
                       const char* target, const char* body, int len )
 {
     // void* 로 받은 컨텍스트를 원래 타입으로 캐스팅하여 사용
@@ -163,7 +173,7 @@ void OnClientMessage( TcpServerContext* ctx, int client_fd, void* service_ctx,
         int current_users = ctx->GetClientCount( ctx );
 
         printf( "[Login] User: %s (FD: %d) | Ver: %d | Current Users: %d\n",
-            pkt->user_id, client_fd, pkt->version, current_users );
+            pkt->user_id, CONN_HANDLE_SLOT( conn ), pkt->version, current_users );
 
         // 환영 메시지 전송 (유니캐스트)
         ChatPacket welcome_msg;
@@ -172,7 +182,7 @@ void OnClientMessage( TcpServerContext* ctx, int client_fd, void* service_ctx,
         welcome_msg.timestamp = 0; // 예시
 
         // 특정 클라이언트에게 전송
-        ctx->Send( ctx, client_fd, TARGET_APP_CHAT, &welcome_msg, sizeof( welcome_msg ) );
+        ctx->Send( ctx, conn, TARGET_APP_CHAT, &welcome_msg, sizeof( welcome_msg ) );
     }
     // -----------------------------------------------------------
     // Case 2: 채팅 메시지 (TARGET_APP_CHAT)
@@ -0,0 +1,88 @@
+/**
+ * 파일명: include/BufferPool.h
+ *
+ * 개요:
+ * 고정 크기 블록을 재사용하는 Thread-Safe 메모리 풀 선언.
+ * 스레드마다 작은 캐시를 두어 평상시 Alloc/Free 는 Lock 없이 처리하고,
+ * 캐시가 비거나 넘칠 때만 풀 전체의 빈 블록 리스트에 Lock을 걸어 묶음으로 주고받는다.
+ * 블록은 필요할 때 Slab 단위로 만들어지며, 최대 개수를 넘으면 힙에서 따로 할당한다. (Miss)
+ */
+
+#ifndef BUFFER_POOL_H
+#define BUFFER_POOL_H
+
+#include <stdint.h>  // uint64_t
+#include <stdbool.h> // bool
+
+// --------------------------------------------------------------------------
+// 1. 타입 정의
+// --------------------------------------------------------------------------
+
+typedef struct BufferPool BufferPool;
+
+/**
+ * ## 풀 사용 현황 (풀 크기 조정용)
+ * 스레드 캐시는 묶음 단위로만 풀과 주고받으므로 값은 근사치이다.
+ */
+typedef struct
+{
+    int block_size;   // 블록 하나의 사용자 영역 크기 (바이트)
+    int capacity;     // 풀이 만들 수 있는 최대 블록 수
+
+    int total_blocks; // 지금까지 만든 블록 수 (capacity 이하)
+    int free_blocks;  // 풀의 빈 블록 리스트에 있는 수 (스레드 캐시 제외)
+    int used_blocks;  // 대여 중이거나 스레드 캐시에 보관 중인 수 (= total - free)
+    int heap_blocks;  // 풀이 가득 차 힙에서 따로 할당되어 아직 반납되지 않은 수
+
+    uint64_t miss_count; // 풀이 가득 차 힙으로 할당한 누적 횟수
+} BufferPoolStats;
+
+
+// --------------------------------------------------------------------------
+// 2. 함수 선언
+// --------------------------------------------------------------------------
+
+/**
+ * ##   고정 크기 블록 풀을 생성한다.
+ * #### 블록은 미리 만들지 않고, 처음 필요할 때 Slab 단위로 만든다.
+ *
+ * ### [Params]
+ * - block_size : 블록 하나의 크기 (0보다 커야 함)
+ * - capacity   : 풀이 만들 최대 블록 수 (0보다 커야 함)
+ *
+ * ### [Return]
+ * - 생성된 BufferPool 포인터 (실패 시 NULL)
+ */
+BufferPool* BufferPool_Create( int block_size, int capacity );
+
+/**
+ * ##   풀과 풀이 만든 모든 블록을 해제한다.
+ * #### 다른 스레드가 더 이상 풀을 사용하지 않을 때 호출해야 한다.
+ * #### 힙으로 할당된(Miss) 블록은 각자 BufferPool_Free 로 반납되어야 한다.
+ */
+void BufferPool_Destroy( BufferPool* pool );
+
+/**
+ * ##   블록 하나를 빌린다. (Thread-Safe)
+ * #### 스레드 캐시에 블록이 있으면 Lock 없이 반환한다. 풀이 가득 찼으면 힙에서 할당한다.
+ *
+ * ### [Return]
+ * - block_size 크기의 블록 포인터 (메모리 부족 시 NULL)
+ */
+void* BufferPool_Alloc( BufferPool* pool );
+
+/**
+ * ##   빌린 블록을 반납한다. (Thread-Safe)
+ * #### 블록이 어느 풀(또는 힙)에서 왔는지는 블록 헤더로 판단하므로 풀을 넘길 필요가 없다.
+ *
+ * ### [Param]
+ * - block : BufferPool_Alloc 이 반환한 포인터 (NULL이면 무시)
+ */
+void BufferPool_Free( void* block );
+
+/**
+ * ## 풀 사용 현황을 out 에 채운다. (Thread-Safe)
+ */
+void BufferPool_GetStats( BufferPool* pool, BufferPoolStats* out );
+
+#endif // BUFFER_POOL_H
@@ -22,7 +22,12 @@
 #define CHECKSUM_LEN     1         // 체크섬의 크기 (1 byte)
 
 // 보안 핸드셰이크용 타겟 코드
-#define TARGET_SEC_STRATEGY "SEC_ARG"
+#define TARGET_SEC_STRATEGY "SEC_ARG" // 서버 -> 클라이언트: 사용할 암호화 전략 통보 (평문)
+#define TARGET_SEC_ACK      "SEC_ACK" // 클라이언트 -> 서버: 전략 적용 완료 (협상된 전략으로 암호화)
+
+// 연결 유지 확인용 타겟 코드 (바디 없음, 라이브러리가 소비하며 OnMessage 에 전달하지 않음)
+#define TARGET_HEARTBEAT_PING "HB_PING" // 서버 -> 클라이언트: 생존 확인
+#define TARGET_HEARTBEAT_PONG "HB_PONG" // 클라이언트 -> 서버: 생존 응답
 
 
 // --------------------------------------------------------------------------
@@ -0,0 +1,81 @@
+/**
+ * 파일명: include/Epoch.h
+ *
+ * 개요:
+ * Epoch 기반 지연 해제(Epoch-Based Reclamation) 선언.
+ * 읽는 쪽은 Lock 없이 공유 포인터를 따라가고, 쓰는 쪽은 떼어낸 객체를 바로 해제하지 않고 Retire 한다.
+ * Retire 된 객체는 그 시점에 읽고 있던 스레드가 모두 빠져나간 뒤(Epoch 두 단계 이후)에만 해제된다.
+ */
+
+#ifndef EPOCH_H
+#define EPOCH_H
+
+#include <stdbool.h> // bool
+
+// --------------------------------------------------------------------------
+// 1. 타입 정의
+// --------------------------------------------------------------------------
+
+typedef struct EpochDomain EpochDomain;
+
+/**
+ * ## [EpochFreeFunc]
+ * 유예 기간이 끝난 객체를 해제할 때 호출되는 함수. (Retire/Collect 를 호출한 스레드에서 실행)
+ */
+typedef void ( *EpochFreeFunc )( void* ptr );
+
+
+// --------------------------------------------------------------------------
+// 2. 함수 선언
+// --------------------------------------------------------------------------
+
+/**
+ * ## 새 Epoch 도메인을 생성한다. (실패 시 NULL)
+ */
+EpochDomain* Epoch_Create( void );
+
+/**
+ * ##   도메인과 아직 해제되지 않은 모든 Retire 객체를 해제한다.
+ * #### 어떤 스레드도 읽기 구간 안에 있지 않을 때 호출해야 한다.
+ */
+void Epoch_Destroy( EpochDomain* domain );
+
+/**
+ * ##   읽기 구간에 들어간다. (Lock-Free, 어느 스레드에서나 호출 가능)
+ * #### 구간 안에서 읽은 공유 포인터는 Epoch_Exit 전까지 해제되지 않는다.
+ * #### 구간은 짧게 유지해야 한다. (구간이 길어지면 그동안 Retire 된 객체의 해제가 미뤄짐)
+ *
+ * ### [Return]
+ * - Epoch_Exit 에 넘길 슬롯 번호
+ */
+int Epoch_Enter( EpochDomain* domain );
+
+/**
+ * ## 읽기 구간을 빠져나온다. (slot: Epoch_Enter 의 반환값)
+ */
+void Epoch_Exit( EpochDomain* domain, int slot );
+
+/**
+ * ##   공유 구조에서 떼어낸 객체의 해제를 예약한다. (Thread-Safe)
+ * #### 반드시 다른 스레드가 더 이상 새로 찾을 수 없게 된 뒤에 호출해야 한다.
+ * #### 유예 기간이 이미 끝난 객체가 있으면 이 호출 안에서 함께 해제한다.
+ *
+ * ### [Params]
+ * - ptr     : 해제할 객체
+ * - free_fn : 해제 함수
+ */
+void Epoch_Retire( EpochDomain* domain, void* ptr, EpochFreeFunc free_fn );
+
+/**
+ * ##   Epoch를 진행시키고 유예 기간이 끝난 객체를 해제한다. (Thread-Safe)
+ * #### 대기 중인 객체가 없으면 거의 비용 없이 반환하므로 이벤트 루프마다 호출해도 된다.
+ */
+void Epoch_Collect( EpochDomain* domain );
+
+/**
+ * ##   해제를 기다리는 Retire 객체가 남아있는지 확인한다. (Lock-Free)
+ * #### 이벤트 루프가 무기한 대기에 들어가기 전에 Collect 를 다시 시도할지 판단하는 데 쓴다.
+ */
+bool Epoch_HasPending( EpochDomain* domain );
+
+#endif // EPOCH_H
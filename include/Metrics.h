@@ -0,0 +1,112 @@
+/**
+ * 파일명: include/Metrics.h
+ *
+ * 개요:
+ * 송수신 파이프라인의 누적 카운터(바이트/프레임/파싱 실패/Drop 등)를 모으는 Lock-Free 레지스트리 선언.
+ * 스레드마다 서로 다른 캐시 라인의 카운터 슬롯에 더하므로 핫 패스에서 Lock 이나 캐시 라인 경합이 없고,
+ * 조회(Metrics_GetStats) 시에만 모든 슬롯을 합친다.
+ */
+
+#ifndef METRICS_H
+#define METRICS_H
+
+#include "CommonDef.h" // PacketResult
+
+#include <stdint.h>  // uint64_t
+
+// --------------------------------------------------------------------------
+// 1. 타입 정의
+// --------------------------------------------------------------------------
+
+typedef struct Metrics Metrics;
+
+#define METRICS_PACKET_RESULTS ( PKT_ERR_NULL_PTR + 1 ) // PacketResult 값 개수 (parse_errors 배열 크기)
+
+/**
+ * ## 카운터 종류 (Metrics_Add 의 id)
+ */
+typedef enum
+{
+    METRIC_BYTES_IN = 0,  // 소켓에서 읽은 바이트
+    METRIC_BYTES_OUT,     // 소켓에 쓴 바이트
+    METRIC_FRAMES_IN,     // 수신한 완성 프레임
+    METRIC_FRAMES_OUT,    // 전송(또는 송신 대기열에 예약)한 프레임
+
+    METRIC_PARSE_ERROR,   // 파싱 실패 (+ PacketResult, PKT_SUCCESS 칸은 사용하지 않음)
+    METRIC_PARSE_ERROR_END = METRIC_PARSE_ERROR + METRICS_PACKET_RESULTS - 1,
+
+    METRIC_RECV_STALLS,   // 워커 큐가 가득 차 전달을 미룬 프레임 (수신 버퍼에 남겨 재개 후 다시 전달)
+    METRIC_SEND_DROPS,    // 송신 큐가 가득 찼거나 송신 대기열 한도를 넘어 버린 프레임
+    METRIC_PARTIAL_WRITES,// 요청보다 적게 쓰여 나머지를 대기열(또는 재시도)로 넘긴 쓰기
+    METRIC_ACCEPTS,       // 수립된 연결 (서버: 수락, 클라이언트: 핸드셰이크 성공)
+    METRIC_DISCONNECTS,   // 끊긴 연결
+
+    METRIC_COUNT
+} MetricId;
+
+/**
+ * ## [TcpStats]
+ * 카운터 스냅샷. 서버/클라이언트의 GetStats 로 조회한다.
+ * 카운터는 생성 이후 누적값이며, 여러 스레드가 동시에 더하는 중에 합치므로 항목 간에 약간 어긋날 수 있다.
+ */
+typedef struct
+{
+    uint64_t bytes_in;
+    uint64_t bytes_out;
+    uint64_t frames_in;
+    uint64_t frames_out;
+
+    uint64_t parse_errors[METRICS_PACKET_RESULTS]; // PacketResult 별 파싱 실패 (PKT_SUCCESS 칸은 항상 0)
+
+    uint64_t recv_stalls;
+    uint64_t send_drops;
+    uint64_t partial_writes;
+    uint64_t accepts;
+    uint64_t disconnects;
+
+    // 큐 현황 (서버만 채움. 수신 큐는 모든 워커 큐의 합/최댓값)
+    int recv_queue_depth; // 지금 워커 큐들에 들어있는 태스크 수
+    int recv_queue_high;  // 워커 큐 하나가 가장 많이 찼을 때의 수
+    int send_queue_depth; // 지금 송신 큐에 들어있는 요청 수
+    int send_queue_high;  // 송신 큐가 가장 많이 찼을 때의 수
+} TcpStats;
+
+
+// --------------------------------------------------------------------------
+// 2. 함수 선언
+// --------------------------------------------------------------------------
+
+/**
+ * ## 카운터 레지스트리를 생성한다. (모든 카운터 0)
+ *
+ * ### [Return]
+ * - 생성된 레지스트리 (실패 시 NULL)
+ */
+Metrics* Metrics_Create( void );
+
+/**
+ * ## 레지스트리를 해제한다.
+ */
+void Metrics_Destroy( Metrics* metrics );
+
+/**
+ * ##   카운터에 값을 더한다. (Thread-Safe, Lock-Free)
+ * #### 호출한 스레드의 슬롯에만 쓰므로 다른 스레드와 캐시 라인을 다투지 않는다.
+ */
+void Metrics_Add( Metrics* metrics, MetricId id, uint64_t value );
+
+/**
+ * ## 파싱 실패 하나를 결과 코드별 카운터에 더한다. (PKT_SUCCESS 는 무시)
+ */
+void Metrics_AddParseError( Metrics* metrics, PacketResult result );
+
+/**
+ * ##   모든 스레드 슬롯을 합쳐 카운터 항목을 채운다. (큐 현황 항목은 0)
+ *
+ * ### [Params]
+ * - metrics : 레지스트리 (NULL 이면 모두 0)
+ * - out     : 결과를 채울 구조체
+ */
+void Metrics_GetStats( Metrics* metrics, TcpStats* out );
+
+#endif // METRICS_H
@@ -0,0 +1,127 @@
+/**
+ * 파일명: include/MpmcQueue.h
+ *
+ * 개요:
+ * 여러 생산자/여러 소비자(MPMC)가 Lock 없이 사용할 수 있는 Bounded Ring Buffer Queue 선언.
+ * 미리 할당한 슬롯 배열만 사용하므로 Enqueue/Dequeue 시 메모리 할당이 없다.
+ * SafeQueue 와 같은 함수 구성을 가지며, 소비자는 큐가 비어있을 때만 대기(Blocking)한다.
+ */
+
+#ifndef MPMC_QUEUE_H
+#define MPMC_QUEUE_H
+
+#include "SafeQueue.h" // FreeNodeFunc
+
+#include <stdbool.h> // bool
+
+// --------------------------------------------------------------------------
+// 1. 타입 정의
+// --------------------------------------------------------------------------
+
+typedef struct MpmcQueue MpmcQueue;
+
+
+// --------------------------------------------------------------------------
+// 2. 함수 선언
+// --------------------------------------------------------------------------
+
+/**
+ * ##   유한한 크기를 가지는 MpmcQueue 객체를 생성한다.
+ * #### 슬롯 인덱스 계산을 위해 capacity는 2의 거듭제곱으로 올림된다. (예: 1000 -> 1024)
+ *
+ * ### [Params]
+ * - capacity : 큐가 담을 수 있는 최소 아이템 개수 (0보다 커야 함)
+ *
+ * ### [Return]
+ * - 생성된 MpmcQueue 포인터 (실패 시 NULL)
+ */
+MpmcQueue* MpmcQueue_Create( int capacity );
+
+/**
+ * ##   MpmcQueue를 파괴하고 내부 메모리를 정리한다.
+ * #### 모든 생산자/소비자 스레드가 멈춘 뒤 호출해야 한다. 남은 데이터는 free_func로 정리한다.
+ *
+ * ### [Param]
+ * - queue     : 파괴할 큐 객체
+ * - free_func : 데이터 해제용 콜백 (NULL일 경우 데이터는 해제하지 않음)
+ */
+void MpmcQueue_Destroy( MpmcQueue* queue, FreeNodeFunc free_func );
+
+/**
+ * ##   큐에 데이터를 추가한다. (Lock-Free, Non-Blocking)
+ * #### 큐가 가득 찼다면 대기하지 않고 즉시 실패를 반환한다.
+ *
+ * ### [Param]
+ * - queue : 대상 큐 객체
+ * - data  : 추가할 데이터 포인터 (NULL이 아니어야 함)
+ *
+ * ### [Return]
+ * - true : 추가 성공
+ * - false: 큐가 가득 차서 실패
+ */
+bool MpmcQueue_Enqueue( MpmcQueue* queue, void* data );
+
+/**
+ * ##   여러 데이터를 한 번에 추가한다. (Lock-Free, Non-Blocking)
+ * #### 앞에서부터 들어가는 만큼만 추가하며, 대기 중인 소비자는 마지막에 한 번만 깨운다.
+ *
+ * ### [Param]
+ * - queue : 대상 큐 객체
+ * - items : 추가할 데이터 포인터 배열 (각 원소는 NULL이 아니어야 함)
+ * - count : 배열 원소 개수
+ *
+ * ### [Return]
+ * - 실제로 추가된 개수 (items[0] ~ items[반환값-1], 큐가 가득 차면 count보다 작음)
+ */
+int MpmcQueue_EnqueueBatch( MpmcQueue* queue, void** items, int count );
+
+/**
+ * ##   큐에서 데이터를 꺼낸다. (Blocking)
+ * #### 데이터가 있으면 Lock 없이 꺼내고, 비어있을 때만 데이터가 들어올 때까지 스레드를 대기시킨다.
+ *
+ * ### [Param]
+ * - queue : 대상 큐 객체
+ *
+ * ### [Return]
+ * - 꺼낸 데이터 포인터 (오류 시 NULL)
+ */
+void* MpmcQueue_Dequeue( MpmcQueue* queue );
+
+/**
+ * ##   큐에서 최대 max개의 데이터를 한 번에 꺼낸다. (Blocking)
+ * #### 비어있을 때만 1개 이상 들어올 때까지 대기하고, 이후 남은 데이터를 대기 없이 꺼낸다.
+ *
+ * ### [Param]
+ * - queue : 대상 큐 객체
+ * - out   : 꺼낸 데이터를 담을 배열 (max 이상)
+ * - max   : 꺼낼 최대 개수
+ *
+ * ### [Return]
+ * - 꺼낸 개수 (오류 시 0)
+ */
+int MpmcQueue_DequeueBatch( MpmcQueue* queue, void** out, int max );
+
+/**
+ * ## 큐에서 데이터를 꺼낸다. (Lock-Free, Non-Blocking)
+ *
+ * ### [Return]
+ * - 꺼낸 데이터 포인터 (비어있으면 NULL)
+ */
+void* MpmcQueue_TryDequeue( MpmcQueue* queue );
+
+/**
+ * ## 큐가 현재 비어있는지 확인한다. (Non-blocking, 다른 스레드가 동시에 사용 중이면 근사값)
+ */
+bool MpmcQueue_IsEmpty( MpmcQueue* queue );
+
+/**
+ * ## 큐가 현재 가득 찼는지 확인한다. (Non-blocking, 다른 스레드가 동시에 사용 중이면 근사값)
+ */
+bool MpmcQueue_IsFull( MpmcQueue* queue );
+
+/**
+ * ## 큐에 들어있는 데이터 개수를 반환한다. (Non-blocking, 다른 스레드가 동시에 사용 중이면 근사값)
+ */
+int MpmcQueue_Size( MpmcQueue* queue );
+
+#endif // MPMC_QUEUE_H
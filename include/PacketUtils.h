@@ -11,6 +11,8 @@
 
 #include "CommonDef.h" // PacketResult enum, PacketHeader 구조체 등 공통 정의 사용
 
+#include <sys/uio.h>    // struct iovec (writev / sendmsg 용 Scatter-Gather 벡터)
+
 // --------------------------------------------------------------------------
 // 1. 암호화 / 복호화 유틸리티
 // --------------------------------------------------------------------------
@@ -68,6 +70,50 @@ int Packet_Serialize( char* out_buffer, int max_buf_size,
                       EncryptFunc encrypt_func );
 
 
+/**
+ * ##   복사 없이 전송하기 위한 패킷 프레임 (Scatter-Gather)
+ * #### 헤더와 체크섬만 구조체 내부에 만들고, 바디는 원본(또는 암호화 버퍼)을 그대로 가리킨다.
+ * #### iov 배열을 writev / sendmsg 에 그대로 넘기면 [Header][Body][CheckSum] 순서로 전송된다.
+ *
+ * 주의: iov가 구조체 내부(header, checksum)를 가리키므로 프레임을 복사하면 안 된다. (포인터로만 전달)
+ */
+typedef struct
+{
+    PacketHeader header;    // 직렬화된 헤더 (네트워크 바이트 오더)
+    uint8_t      checksum;  // 헤더 + (암호화된) 바디의 체크섬
+
+    struct iovec iov[3];    // [0] 헤더, [1] 바디 (없으면 생략), [2] 체크섬
+    int          iov_count;
+    int          total_len; // 전체 패킷 길이 (= header.total_len)
+} PacketFrame;
+
+/**
+ * ##   바디를 복사하지 않고 전송용 프레임을 구성한다. (Zero-Copy Serialize)
+ * #### 암호화가 없으면 body_ptr 을 그대로 가리키고,
+ * #### 암호화가 있으면 enc_buf 에 복사와 암호화, 체크섬 계산을 한 번의 순회로 수행한다.
+ *
+ * ### [Param]
+ * - frame        : 결과가 저장될 프레임
+ * - target_code  : 패킷 타겟 문자열 (예: "LOGIN")
+ * - body_ptr     : 전송할 실제 데이터 포인터 (암호화가 없으면 전송 완료 시점까지 유효해야 함)
+ * - body_len     : 바디 데이터의 크기
+ * - encrypt_func : 바디 암호화 함수 포인터 (NULL일 경우 암호화 안 함)
+ * - enc_buf      : 암호화된 바디를 담을 버퍼 (body_len 이상, encrypt_func 가 NULL이면 사용 안 함)
+ *
+ * ### [Return]
+ * - 총 패킷 길이 (0보다 작으면 에러: DEFAULT_BUF_SIZE 초과 또는 enc_buf 누락)
+ *
+ * ### [Example]
+ * - PacketFrame frame;
+ * - if( Packet_BuildFrame( &frame, target, body, len, ctx->encrypt_fn, scratch ) > 0 )
+ * -     writev( fd, frame.iov, frame.iov_count );
+ */
+int Packet_BuildFrame( PacketFrame* frame,
+                       const char* target_code,
+                       const void* body_ptr, int body_len,
+                       EncryptFunc encrypt_func, char* enc_buf );
+
+
 // --------------------------------------------------------------------------
 // 4. 역직렬화 (Deserialize) - 수신용
 // --------------------------------------------------------------------------
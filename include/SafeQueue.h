@@ -18,6 +18,15 @@
 
 typedef struct SafeQueue SafeQueue;
 
+/**
+ * ## 큐 내부 구현 방식
+ */
+typedef enum
+{
+    SAFE_QUEUE_LOCKED = 0, // Mutex + Linked List (기본값, 용량 정확히 지킴)
+    SAFE_QUEUE_LOCKFREE    // Lock-Free Ring Buffer (MpmcQueue, 원소당 할당 없음, 용량은 2의 거듭제곱으로 올림)
+} SafeQueueType;
+
 /**
  * ## 큐 내부의 데이터를 해제할 때 사용할 함수 포인터 타입
  *
@@ -48,6 +57,19 @@ typedef void ( *FreeNodeFunc )( void* data );
  */
 SafeQueue* SafeQueue_Create( int capacity );
 
+/**
+ * ## 구현 방식을 지정하여 SafeQueue 객체를 생성한다.
+ * #### SAFE_QUEUE_LOCKFREE 를 지정하면 아래 모든 함수가 내부적으로 MpmcQueue 를 사용한다.
+ *
+ * ### [Params]
+ * - capacity : 큐가 담을 수 있는 최대 아이템 개수 (0보다 커야 함)
+ * - type     : 내부 구현 방식
+ *
+ * ### [Return]
+ * - 생성된 SafeQueue 포인터 (실패 시 NULL)
+ */
+SafeQueue* SafeQueue_CreateEx( int capacity, SafeQueueType type );
+
 /**
  * ##   SafeQueue를 파괴하고 내부 메모리를 정리한다.
  * #### 큐에 남아있는 데이터는 free_func를 이용해 정리한다.
@@ -72,6 +94,20 @@ void SafeQueue_Destroy( SafeQueue* queue, FreeNodeFunc free_func );
  */
 bool SafeQueue_Enqueue( SafeQueue* queue, void* data );
 
+/**
+ * ##   여러 데이터를 한 번의 Lock으로 추가한다. (Thread-Safe, Non-Blocking)
+ * #### 앞에서부터 용량이 허용하는 만큼만 추가하고, 대기 중인 소비자는 한 번만 깨운다.
+ *
+ * ### [Param]
+ * - queue : 대상 큐 객체
+ * - items : 추가할 데이터 포인터 배열 (각 원소는 NULL이 아니어야 함)
+ * - count : 배열 원소 개수
+ *
+ * ### [Return]
+ * - 실제로 추가된 개수 (items[0] ~ items[반환값-1]. 나머지의 소유권은 호출자에게 남음)
+ */
+int SafeQueue_EnqueueBatch( SafeQueue* queue, void** items, int count );
+
 /**
  * ##   큐에서 데이터를 꺼낸다. (Blocking)
  * #### 큐가 비어있다면 데이터가 들어올 때까지 스레드를 대기시킨다.
@@ -84,6 +120,24 @@ bool SafeQueue_Enqueue( SafeQueue* queue, void* data );
  */
 void* SafeQueue_Dequeue( SafeQueue* queue );
 
+/**
+ * ##   큐에서 최대 max개의 데이터를 한 번의 Lock으로 꺼낸다. (Blocking)
+ * #### 큐가 비어있다면 1개 이상 들어올 때까지 대기한 뒤, 그 시점에 쌓인 데이터를 최대 max개까지 꺼낸다.
+ *
+ * ### [Param]
+ * - queue : 대상 큐 객체
+ * - out   : 꺼낸 데이터를 담을 배열 (max 이상)
+ * - max   : 꺼낼 최대 개수
+ *
+ * ### [Return]
+ * - 꺼낸 개수 (오류 시 0, 꺼낸 순서는 Enqueue 순서와 같음)
+ *
+ * ### [Example]
+ * - void* items[32];
+ * - int n = SafeQueue_DequeueBatch( queue, items, 32 );
+ */
+int SafeQueue_DequeueBatch( SafeQueue* queue, void** out, int max );
+
 /**
  * ## 큐가 현재 비어있는지 확인한다. (Non-blocking)
  *
@@ -102,4 +156,14 @@ bool SafeQueue_IsEmpty( SafeQueue* queue );
  */
 bool SafeQueue_IsFull( SafeQueue* queue );
 
+/**
+ * ## 큐에 들어있는 데이터 개수를 반환한다. (Non-blocking, 다른 스레드가 동시에 사용 중이면 근사값)
+ */
+int SafeQueue_Size( SafeQueue* queue );
+
+/**
+ * ## 생성 이후 큐가 가장 많이 찼을 때의 데이터 개수를 반환한다. (Non-blocking, 큐 용량 조정용)
+ */
+int SafeQueue_HighWatermark( SafeQueue* queue );
+
 #endif // SAFE_QUEUE_H
\ No newline at end of file
@@ -0,0 +1,56 @@
+/**
+ * 파일명: include/SharedBuffer.h
+ *
+ * 개요:
+ * 여러 스레드가 복사 없이 함께 참조하는 참조 카운트(Refcount) 버퍼 선언.
+ * 마지막 참조가 Release 될 때 메모리가 해제된다.
+ */
+
+#ifndef SHARED_BUFFER_H
+#define SHARED_BUFFER_H
+
+// --------------------------------------------------------------------------
+// 1. 타입 정의
+// --------------------------------------------------------------------------
+
+/**
+ * ## 참조 카운트 버퍼
+ * data 는 구조체와 한 번에 할당되며, 생성한 쪽이 채운 뒤 공유한다.
+ * 공유를 시작한 이후에는 내용을 수정하지 않아야 한다. (읽기 전용으로 취급)
+ */
+typedef struct
+{
+    int  refcount; // 참조 수 (직접 수정 금지, Retain/Release 사용)
+    int  capacity; // data 최대 크기
+    int  len;      // 유효 데이터 길이 (생성자가 설정)
+    char data[];   // 실제 데이터
+} SharedBuffer;
+
+
+// --------------------------------------------------------------------------
+// 2. 함수 선언
+// --------------------------------------------------------------------------
+
+/**
+ * ##   capacity 크기의 SharedBuffer를 생성한다. (참조 수 1, len 0)
+ *
+ * ### [Params]
+ * - capacity : data 영역 크기 (0보다 커야 함)
+ *
+ * ### [Return]
+ * - 생성된 버퍼 포인터 (실패 시 NULL)
+ */
+SharedBuffer* SharedBuffer_Create( int capacity );
+
+/**
+ * ## 참조 수를 1 늘린다. (Thread-Safe)
+ */
+void SharedBuffer_Retain( SharedBuffer* buf );
+
+/**
+ * ##   참조 수를 1 줄이고, 0이 되면 해제한다. (Thread-Safe)
+ * #### 호출 이후에는 buf 를 사용하면 안 된다.
+ */
+void SharedBuffer_Release( SharedBuffer* buf );
+
+#endif // SHARED_BUFFER_H
@@ -9,6 +9,7 @@
 #define TCP_CLIENT_H
 
 #include "CommonDef.h" // CommonDef의 전방 선언 및 타입 사용
+#include "Metrics.h"   // 송수신 카운터 (TcpStats)
 
 #include <pthread.h>   // pthread_t (스레드 핸들), pthread_mutex_t (뮤텍스)
 
@@ -44,6 +45,7 @@ struct TcpClientContext
 {
     int sockfd;                 // 연결 안됨: -1, 연결됨: >=0
     pthread_mutex_t conn_mutex; // sockfd 접근 보호용 뮤텍스
+    pthread_mutex_t send_mutex; // 프레임 단위 전송 직렬화 (Send 와 수신 스레드의 HB_PONG/SEC_ACK 가 섞이지 않도록)
 
     volatile bool is_running; // 클라이언트 동작 여부
     pthread_t network_thread; // 연결 관리 및 수신 담당 스레드
@@ -52,6 +54,11 @@ struct TcpClientContext
     char server_ip[32];
     int  server_port;
 
+    // 유휴 타임아웃 (밀리초, 0: 끔). 이 시간 동안 아무 프레임도 받지 못하면 연결을 끊고 재연결한다.
+    int idle_timeout_ms;
+
+    Metrics* metrics; // 송수신 카운터 (수신 스레드와 Send 를 호출한 스레드가 각자의 슬롯에 더함)
+
     // 외부 연동 데이터
     void*             service_ctx; // 콜백에 전달할 사용자가 구성한 서비스의 컨텍스트
     OnMessageCallback on_message;  // 수신 시 호출될 함수. 해당 함수에서 service_ctx 이용.
@@ -90,7 +97,7 @@ struct TcpClientContext
 
     /**
      * ##   데이터를 패킷으로 포장하여 전송한다. (Thread-Safe by Socket)
-     * #### 내부적으로 Serialize -> Encrypt -> Send 과정을 수행한다.
+     * #### 내부적으로 헤더/체크섬 생성 -> (Encrypt) -> sendmsg(Scatter-Gather) 과정을 수행한다. (바디 복사 없음)
      *
      * ### [Params]
      * - target   : 패킷 식별 문자열 (예: "CHAT", "LOGIN")
@@ -112,6 +119,26 @@ struct TcpClientContext
      */
     void ( *SetStrategy )( TcpClientContext* ctx, EncryptFunc enc, DecryptFunc dec );
 
+    /**
+     * ##   서버가 응답 없이 사라진 연결(Half-open)을 감지할 유휴 타임아웃을 설정한다.
+     * #### 이 시간 동안 아무 프레임도 받지 못하면 연결을 끊고 재연결한다. (소켓 SO_RCVTIMEO, 추가 스레드 없음)
+     * #### 서버의 heartbeat_interval_ms 보다 길게 두면 조용하지만 살아있는 서버는 HB_PING 으로 유지된다.
+     * #### (서버의 HB_PING 에는 라이브러리가 HB_PONG 으로 자동 응답하며, OnMessage 에 전달하지 않는다)
+     *
+     * ### [Params]
+     * - timeout_ms : 유휴 타임아웃 (밀리초, 0 이하: 끔)
+     */
+    void ( *SetIdleTimeout )( TcpClientContext* ctx, int timeout_ms );
+
+    /**
+     * ##   송수신 카운터를 조회한다. (Lock-Free)
+     * #### accepts 는 핸드셰이크에 성공한 연결(재연결 포함), disconnects 는 끊긴 연결 수이다. (큐 항목은 0)
+     *
+     * ### [Params]
+     * - out : 결과를 채울 구조체
+     */
+    void ( *GetStats )( TcpClientContext* ctx, TcpStats* out );
+
     /**
      * ##   TcpClientContext를 파괴하고 메모리를 해제한다.
      * #### 내부적으로 Disconnect를 호출하여 스레드를 정리한다.
@@ -11,7 +11,11 @@
 #define TCP_SERVER_H
 
 #include "CommonDef.h" // 공통 타입 정의
-#include "SafeQueue.h" // SafeQueue 구조체 및 함수 사용
+#include "SafeQueue.h"    // SafeQueue 구조체 및 함수 사용
+#include "BufferPool.h"   // 수신 태스크 풀 (BufferPoolStats)
+#include "SharedBuffer.h" // SendRef 용 참조 카운트 버퍼
+#include "Epoch.h"        // 클라이언트 레지스트리 지연 해제
+#include "Metrics.h"      // 송수신 카운터 (TcpStats)
 
 #include <pthread.h>   // pthread_t, pthread_mutex_t
 #include <sys/epoll.h> // epoll_event 구조체, epoll_* 함수 관련 타입
@@ -22,6 +26,153 @@
 
 #define MAX_EPOLL_EVENTS 100  // 한 번의 epoll_wait에서 처리할 최대 이벤트 수
 #define QUEUE_CAPACITY   1000 // 큐 최대 크기 (Backpressure 방지)
+#define QUEUE_BATCH_SIZE 32   // 큐에서 한 번의 Lock으로 넣고 꺼내는 최대 태스크 수
+#define MAX_CLIENT_FDS   65536 // FD 인덱스 테이블 최대 크기 (RLIMIT_NOFILE이 더 작으면 그 값 사용)
+
+#define SEND_INLINE_BODY_SIZE 256 // 이 크기 이하의 송신 바디는 태스크 안에 바로 복사한다. (별도 할당 없음)
+
+#define READ_BUDGET_PER_WAKEUP ( 16 * DEFAULT_BUF_SIZE ) // 한 번의 이벤트에서 연결당 읽을 최대 바이트 (공정성 보장)
+#define REACTOR_RECHECK_MS     100 // 깨우기 신호 없이 끝나는 작업(해제 대기 노드, 할당 실패로 멈춘 읽기)이 남았을 때 루프를 다시 도는 간격
+#define EXIT_FLAG_POLL_MS      100 // Run 에 exit_flag 를 넘겼을 때 Reactor 0 이 깨우기 신호 없이도 플래그를 확인하는 최대 간격
+#define TIMER_WHEEL_TICK_MS    10  // Reactor 타이머 휠의 틱 길이 (유휴 타임아웃/Heartbeat 정밀도)
+#define SERVER_TIMER_TICK_MS   1   // ScheduleTimer/SchedulePeriodic 타이머 휠의 틱 길이
+
+/**
+ * ## [ConnHandle]
+ * 연결 하나를 가리키는 64비트 핸들. 하위 32비트는 세션 테이블 슬롯(소켓 FD), 상위 32비트는 그 슬롯의 세대 번호이다.
+ * 연결이 끊긴 뒤 커널이 같은 FD를 재사용해도 세대가 달라지므로, 이전 연결 앞으로 쌓인 송신 요청은
+ * 새 연결에 전달되지 않고 송신 스레드에서 버려진다.
+ */
+typedef uint64_t ConnHandle;
+
+#define CONN_HANDLE_INVALID ( (ConnHandle)0 ) // 어떤 연결도 가리키지 않는 핸들
+
+// 핸들의 슬롯 번호(소켓 FD)를 꺼낸다. (로그 출력용, 연결이 이미 끊겼을 수 있음)
+#define CONN_HANDLE_SLOT( handle ) ( (int)( (handle) & 0xffffffffu ) )
+
+/**
+ * ## [ServerTimerId]
+ * ScheduleTimer/SchedulePeriodic 이 발급하는 타이머 ID. 서버마다 1부터 증가하며 재사용되지 않는다.
+ */
+typedef uint64_t ServerTimerId;
+
+#define SERVER_TIMER_INVALID ( (ServerTimerId)0 ) // 등록 실패
+
+/**
+ * ## [ServerIoBackend]
+ * Reactor가 소켓 IO를 처리하는 방식.
+ */
+typedef enum
+{
+    SERVER_IO_EPOLL = 0, // epoll_wait + 연산마다 recv/send 시스템 콜 (기본값)
+    SERVER_IO_URING      // io_uring: Multishot Accept/Recv + Provided Buffer Ring, 일괄 제출 (Linux 6.0+)
+} ServerIoBackend;
+
+/**
+ * ## [ServerDispatchMode]
+ * 수신한 메시지의 on_message 콜백과 응답 송신을 어느 스레드에서 실행할지.
+ */
+typedef enum
+{
+    SERVER_DISPATCH_WORKER = 0, // Reactor -> RecvQueue -> 워커 -> SendQueue -> 송신 스레드 (기본값)
+    SERVER_DISPATCH_INLINE      // Run-to-Completion: Reactor가 파싱/콜백을 직접 실행하고 응답도 호출 스레드에서 바로 쓴다.
+} ServerDispatchMode;
+
+/**
+ * ## [ServerListenerMode]
+ * Reactor가 2개 이상일 때 리스너 소켓을 나누는 방식.
+ */
+typedef enum
+{
+    SERVER_LISTEN_REUSEPORT = 0, // Reactor마다 SO_REUSEPORT 리스너. 커널이 4-tuple 해시로 연결을 분산한다. (기본값)
+    SERVER_LISTEN_SHARED         // 리스너 하나를 모든 Reactor가 EPOLLEXCLUSIVE 로 공유. 깨어난 Reactor 하나가 대기열을 비운다.
+} ServerListenerMode;
+
+/**
+ * ## [TcpServerConfig]
+ * 서버 생성 시 지정하는 구성값. TcpServer_GetDefaultConfig() 로 기본값을 얻은 뒤 필요한 항목만 수정한다.
+ * 생성 이후에는 ctx->config 로 읽을 수만 있다. (변경해도 반영되지 않음)
+ */
+typedef struct
+{
+    // IO(Epoll) 스레드 수. 각 Reactor는 자신의 Epoll 인스턴스와
+    // SO_REUSEPORT 리스너를 가지며, 커널이 새 연결을 Reactor 간에 분산한다. (기본값: 1)
+    int reactor_count;
+
+    // 워커(on_message 콜백 실행) 스레드 수. 연결은 FD 해시로 하나의 워커에 고정되므로
+    // 한 클라이언트의 메시지 순서는 항상 보장된다. (기본값: 1)
+    // 주의: 2 이상이면 서로 다른 클라이언트의 콜백이 동시에 실행되므로 service_ctx 접근을 직접 동기화해야 한다.
+    int worker_count;
+
+    // 연결별 송신 대기 데이터 한도 (바이트). 소켓 송신 버퍼가 가득 찬 느린 클라이언트에게만 쌓인다.
+    // 브로드캐스트 프레임은 복사 없이 공유 버퍼 참조로 쌓인다. 한도를 넘으면 이후 프레임은 통째로 버려진다. (최소 DEFAULT_BUF_SIZE, 기본값: 64KB)
+    int outbound_buffer_size;
+
+    // IO 백엔드. SERVER_IO_URING 은 연결이 많을 때 시스템 콜 횟수를 크게 줄인다.
+    // 커널/빌드 환경이 지원하지 않으면 Init 시 경고 후 epoll로 대체된다. (기본값: SERVER_IO_EPOLL)
+    ServerIoBackend io_backend;
+
+    // RecvQueue(Reactor -> Worker) 와 SendQueue(Worker -> Sender) 의 구현 방식.
+    // SAFE_QUEUE_LOCKFREE 는 메시지마다 Lock/노드 할당 없이 Ring Buffer 슬롯만 사용한다. (기본값: SAFE_QUEUE_LOCKED)
+    SafeQueueType queue_type;
+
+    // 수신 태스크 풀의 최대 블록 수. 블록 하나에 ServerRecvTask 와 DEFAULT_BUF_SIZE 수신 버퍼가 함께 들어간다.
+    // 블록은 필요할 때만 만들어지며, 모두 사용 중이면 힙에서 따로 할당한다. (Miss, 기본값: 4096)
+    int recv_pool_blocks;
+
+    // 송신 태스크 풀의 최대 블록 수. SEND_INLINE_BODY_SIZE 이하의 바디는 태스크 블록 안에 함께 담긴다.
+    // 모두 사용 중이면 힙에서 따로 할당한다. (Miss, 기본값: 4096)
+    int send_pool_blocks;
+
+    // 수신 Backpressure 워터마크 (워커 RecvQueue 에 쌓인 태스크 수).
+    // 큐가 high 에 닿으면 그 워커로 가는 연결의 소켓 읽기를 멈추고, low 이하로 내려가면 재개한다.
+    // 읽지 않은 데이터는 커널 버퍼에 남아 TCP 흐름 제어가 상대방을 늦추므로 패킷이 버려지지 않는다.
+    // (high 최대 QUEUE_CAPACITY, low 는 high 미만. 기본값: QUEUE_CAPACITY 의 3/4, 1/4)
+    int recv_high_watermark;
+    int recv_low_watermark;
+
+    // 메시지 처리 방식. SERVER_DISPATCH_INLINE 은 큐와 스레드 전환 없이 Reactor 스레드에서 콜백을 실행하고,
+    // Send/Broadcast 도 호출한 스레드에서 바로 소켓에 쓴다. (워커/송신 스레드를 만들지 않음)
+    // 주의: 콜백이 블로킹되면 그 Reactor의 모든 연결이 멈춘다. reactor_count 가 2 이상이면 콜백이 동시에 실행된다.
+    // (이 모드에서는 worker_count, recv 워터마크가 사용되지 않음. 기본값: SERVER_DISPATCH_WORKER)
+    ServerDispatchMode dispatch_mode;
+
+    // 송신 묶음(Coalescing) 한도 (바이트). 송신 스레드는 한 번에 꺼낸 요청들을 연결별로 모아
+    // 연결마다 한 번의 sendmsg 로 보내며, 모인 양이 이 값에 닿으면 그 자리에서 보낸다.
+    // 이미 큐에 쌓인 요청만 묶으므로 전송을 기다리며 지연시키지 않는다. Cork/Uncork 의 한도로도 쓰인다.
+    // (0: 송신 스레드 묶음 끔, 최대 outbound_buffer_size, 기본값: 16KB)
+    int send_coalesce_bytes;
+
+    // listen() 대기열 길이. 재배포 직후 재접속이 몰릴 때 SYN/Accept 대기열이 넘치지 않도록 넉넉히 둔다.
+    // 실제 값은 커널의 net.core.somaxconn 으로 제한된다. (0 이하: SOMAXCONN, 기본값: 4096)
+    int listen_backlog;
+
+    // 리스너 구성 방식. SERVER_LISTEN_SHARED 는 한 리스너를 EPOLLEXCLUSIVE 로 공유해 한가한 Reactor가 먼저 수락한다.
+    // (reactor_count 가 1이면 차이 없음. 기본값: SERVER_LISTEN_REUSEPORT)
+    ServerListenerMode listener_mode;
+
+    // 유휴 타임아웃 (밀리초). 이 시간 동안 아무 프레임도 보내지 않은 연결은 Reactor가 끊는다. (Half-open 연결 정리)
+    // 연결마다 Reactor의 타이머 휠에 타이머 하나를 두므로 연결 수와 무관하게 시스템 콜이 늘지 않는다. (0: 끔, 기본값: 0)
+    int idle_timeout_ms;
+
+    // Heartbeat 간격 (밀리초). 연결이 이 시간 동안 조용하면 서버가 HB_PING 을 보내고, 클라이언트는 HB_PONG 으로 답한다.
+    // idle_timeout_ms 보다 짧게 두면 살아있는 클라이언트는 응답만으로 타임아웃을 피한다. (0: 끔, 기본값: 0)
+    int heartbeat_interval_ms;
+} TcpServerConfig;
+
+/**
+ * ## [ServerBackpressureStats]
+ * 수신 Backpressure 현황. GetBackpressureStats 로 조회한다.
+ */
+typedef struct
+{
+    int paused_workers;     // 지금 high 워터마크를 넘어 읽기가 멈춘 워커 수
+    int paused_connections; // 지금 읽기를 멈추고 재개를 기다리는 연결 수
+
+    uint64_t pause_count;  // 워커 큐가 high 워터마크에 닿은 누적 횟수
+    uint64_t resume_count; // 워커 큐가 low 워터마크 이하로 내려가 재개된 누적 횟수
+} ServerBackpressureStats;
+
 
 // --------------------------------------------------------------------------
 // 2. 내부 태스크 구조체 및 전방 선언
@@ -30,27 +181,49 @@
 // 클라이언트 연결 관리용 노드 (내부 구현은 .c 파일에 은닉)
 struct ClientNode;
 
+// IO 루프(Epoll) 상태 (내부 구현은 .c 파일에 은닉)
+struct ServerReactor;
+
+// 워커 스레드 상태 (내부 구현은 .c 파일에 은닉)
+struct ServerWorker;
+
+// ScheduleTimer/SchedulePeriodic 으로 등록된 타이머 (내부 구현은 .c 파일에 은닉)
+struct ServerTimer;
+
 /**
  * IO 스레드(Epoll)가 수신한 데이터를 워커 스레드로 넘길 때 사용하는 구조체
  */
 typedef struct
 {
-    int   client_fd; // 데이터를 보낸 클라이언트 소켓
-    char* data;      // 수신된 원본 데이터 (힙 할당됨, 워커가 해제해야 함)
-    int   len;       // 데이터 길이
+    ConnHandle conn; // 데이터를 보낸 연결 (CONN_HANDLE_INVALID면 종료 신호)
+    char*      data; // 수신된 완성 패킷 1개 (Header+Body+CheckSum, 태스크와 같은 풀 블록 안에 있음)
+    int        len;  // 데이터 길이 (= PacketHeader.total_len)
+
+    struct ServerTimer* timer; // NULL이 아니면 만료된 사용자 타이머 (워커가 콜백 실행, conn/data 사용 안 함)
 } ServerRecvTask;
 
+/**
+ * ## [ReleaseBodyFunc]
+ * SendOwned 로 소유권을 넘긴 바디를 다 쓴 뒤 해제할 때 호출되는 함수. (송신 스레드 또는 호출 스레드에서 실행)
+ */
+typedef void ( *ReleaseBodyFunc )( void* body );
+
 /**
  * 워커 스레드가 처리를 마치고 송신 스레드로 넘길 때 사용하는 구조체
  */
 typedef struct
 {
-    int  client_fd;    // 받을 대상 (-1이면 Broadcast, -2면 종료 신호)
-    bool is_broadcast; // 브로드캐스트 여부
+    ConnHandle conn;         // 받을 대상 (Broadcast가 아닌데 CONN_HANDLE_INVALID면 종료 신호)
+    bool       is_broadcast; // 브로드캐스트 여부
 
     char  target[TARGET_NAME_LEN]; // 패킷 타겟 코드
-    char* body_data; // 전송할 바디 데이터 (힙 할당됨, 송신자가 해제해야 함)
+    char* body_data; // 전송할 바디 데이터 (작으면 inline_body, 크면 힙 할당됨. 송신자가 해제해야 함)
     int   body_len;  // 바디 길이
+
+    ReleaseBodyFunc body_release; // body_data 해제 함수 (SendOwned, NULL이면 free)
+    SharedBuffer*   body_ref;     // 참조 중인 공유 버퍼 (SendRef, 송신 후 Release)
+
+    char inline_body[SEND_INLINE_BODY_SIZE]; // 작은 바디 저장소 (태스크와 한 번에 할당됨)
 } ServerSendTask;
 
 
@@ -61,21 +234,35 @@ typedef struct
 /**
  * ## [OnServerMessageCallback]
  * 워커 스레드가 패킷을 파싱한 후 비즈니스 로직을 수행하기 위해 호출하는 콜백.
+ * (SERVER_DISPATCH_INLINE 모드에서는 연결을 담당하는 Reactor 스레드에서 호출된다)
  *
  * ### [Params]
  * - srv_ctx     : 서버 컨텍스트 포인터
- * - client_fd   : 메시지를 보낸 클라이언트의 소켓 FD
+ * - conn        : 메시지를 보낸 연결의 핸들 (Send 등에 그대로 넘긴다)
  * - service_ctx : 사용자 정의 데이터 (ServiceContext 등)
  * - target      : 패킷 타겟 코드 (예: "LOGIN")
  * - body        : 복호화된 바디 데이터 포인터
  * - len         : 바디 길이
  */
 typedef void ( *OnServerMessageCallback )( TcpServerContext* srv_ctx,
-                                           int client_fd,
+                                           ConnHandle conn,
                                            void* service_ctx,
                                            const char* target,
                                            const char* body, int len );
 
+/**
+ * ## [OnServerTimerCallback]
+ * ScheduleTimer/SchedulePeriodic 으로 등록한 타이머가 만료되면 호출되는 콜백.
+ * 워커 0 에서 on_message 와 같은 순서로 실행되므로, worker_count 가 1이면 service_ctx 를 Lock 없이 다룰 수 있다.
+ * (SERVER_DISPATCH_INLINE 모드에서는 Reactor 0, 즉 Run 호출 스레드에서 호출된다)
+ *
+ * ### [Params]
+ * - srv_ctx     : 서버 컨텍스트 포인터
+ * - service_ctx : 사용자 정의 데이터 (ServiceContext 등)
+ * - arg         : 등록할 때 넘긴 인자
+ */
+typedef void ( *OnServerTimerCallback )( TcpServerContext* srv_ctx, void* service_ctx, void* arg );
+
 
 // --------------------------------------------------------------------------
 // 4. 서버 컨텍스트 구조체 정의
@@ -83,25 +270,52 @@ typedef void ( *OnServerMessageCallback )( TcpServerContext* srv_ctx,
 
 struct TcpServerContext
 {
-    volatile bool is_running; // 서버 가동 상태 플래그
+    volatile bool is_running;     // 서버 가동 상태 플래그
+    volatile bool stop_requested; // Stop 호출 여부 (Run 루프 탈출 요청)
+
+    TcpServerConfig config; // 생성 시 지정된 구성값 (읽기 전용)
 
     // --- [Network Core] ---
-    int listen_fd;
-    int epoll_fd;
-    struct epoll_event* events; // Epoll 이벤트 버퍼
+    struct ServerReactor* reactors;      // IO 루프 배열 (Reactor마다 Epoll + SO_REUSEPORT 리스너)
+    int                   reactor_count;
+    ServerIoBackend       io_backend;    // 실제 사용 중인 IO 백엔드 (io_uring 미지원 시 EPOLL로 대체됨)
+    SharedBuffer*         handshake_frame; // Init 에서 한 번 직렬화한 핸드셰이크 프레임 (모든 연결의 송신 대기열이 참조)
+    SharedBuffer*         heartbeat_frame; // Init 에서 한 번 직렬화한 HB_PING 프레임 (바디가 없어 전략과 무관)
 
     // --- [Thread Management] ---
-    pthread_t worker_thread; // 작업 전담 스레드
-    pthread_t sender_thread; // 송신 전담 스레드
+    struct ServerWorker* workers;       // 작업 전담 스레드 배열 (워커마다 RecvQueue 보유)
+    int                  worker_count;
+    pthread_t            sender_thread; // 송신 전담 스레드
+    bool                 sender_started;
 
     // --- [Data Pipeline (Queues)] ---
-    SafeQueue* recv_queue; // Epoll  -> Worker (ServerRecvTask*)
-    SafeQueue* send_queue; // Worker -> Sender (ServerSendTask*)
+    // (RecvQueue는 워커마다 하나씩, workers[i] 내부에 있음: Epoll -> Worker (ServerRecvTask*))
+    SafeQueue* send_queue;         // Worker -> Sender (ServerSendTask*)
+    int        pending_broadcasts; // (atomic) SendQueue 에 들어있는 Broadcast 수 (있으면 직접 쓰기 생략)
+
+    // --- [Memory Pools] ---
+    BufferPool* recv_pool; // ServerRecvTask + 수신 버퍼 블록 (Reactor가 빌리고 Worker가 반납)
+    BufferPool* send_pool; // ServerSendTask 블록 (Worker가 빌리고 Sender가 반납)
 
     // --- [Client Management] ---
-    struct ClientNode* client_list_head;  // 연결된 클라이언트 리스트 헤드
-    pthread_mutex_t    client_list_mutex; // 리스트 접근 동기화용 뮤텍스
-    volatile int       current_client_count;
+    // FD -> ClientNode 인덱스. 각 칸은 그 FD를 수락한 Reactor만 쓰고, 다른 스레드는 Lock 없이 읽는다.
+    struct ClientNode** client_table;
+    int                 client_table_size;    // client_table 원소 개수
+    uint32_t*           client_generations;   // 슬롯별 마지막으로 발급한 세대 번호 (ConnHandle 상위 32비트)
+    int                 client_high_fd;       // (atomic) 등록된 적 있는 가장 큰 FD + 1 (Broadcast 순회 범위)
+    EpochDomain*        client_epoch;         // 제거된 노드의 지연 해제 (다른 스레드는 읽기 구간 안에서만 노드 접근)
+    int                 current_client_count; // (atomic) 현재 연결 수
+    int                 paused_connections;   // (atomic) 워커 큐가 가득 차 읽기를 멈춘 연결 수
+
+    // --- [Metrics] ---
+    Metrics* metrics; // 스레드별 송수신 카운터 (GetStats 가 합쳐서 조회)
+
+    // --- [User Timers] ---
+    // 휠은 Reactor 0 이 루프마다 돌리고, 만료된 타이머는 워커 0 의 RecvQueue 로 보내 콜백을 실행한다.
+    pthread_mutex_t     timer_mutex;   // 아래 필드 보호 (Schedule/Cancel 은 어느 스레드에서나 호출 가능)
+    struct TimerWheel*  timer_wheel;   // 사용자 타이머 휠 (SERVER_TIMER_TICK_MS)
+    struct ServerTimer* timer_list;    // 등록된 모든 타이머 (Cancel 시 ID로 찾음)
+    ServerTimerId       next_timer_id; // 다음에 발급할 ID
 
     // --- [User & Strategy] ---
     void*                   service_ctx; // on_message 콜백에 전달할 사용자가 구성한 서비스의 컨텍스트
@@ -112,7 +326,7 @@ struct TcpServerContext
 
     /**
      * ##   서버를 초기화하고 포트를 바인딩한다. (Listen 시작)
-     * #### 내부적으로 Epoll 인스턴스와 소켓을 생성한다.
+     * #### 내부적으로 Reactor마다 Epoll 인스턴스와 리스너 소켓을 생성한다.
      *
      * ### [Params]
      * - ctx  : 서버 컨텍스트
@@ -125,31 +339,85 @@ struct TcpServerContext
 
     /**
      * ##   서버 루프를 실행한다. (Blocking)
-     * #### 워커 스레드와 송신 스레드를 생성하고, 메인 스레드는 Epoll 루프에 진입한다.
+     * #### 워커 스레드, 송신 스레드, 추가 Reactor 스레드를 생성하고, 메인 스레드는 Reactor 0 의 Epoll 루프에 진입한다.
+     * #### (SERVER_DISPATCH_INLINE 모드는 워커/송신 스레드를 만들지 않는다)
+     * #### 루프를 빠져나오면 나머지 Reactor 스레드도 정지시킨 뒤 반환한다.
+     * #### 할 일이 없으면 이벤트나 깨우기 신호(eventfd)가 올 때까지 대기한다. (exit_flag 가 있으면 Reactor 0 은 최대 EXIT_FLAG_POLL_MS)
      *
      * ### [Params]
      * - ctx : 서버 컨텍스트
      * - exit_flag :
      *   외부에서 종료 신호를 줄 플래그 포인터 (NULL이면 사용 안 함)
-     *   이 값이 true가 되면 루프를 탈출한다.
+     *   Reactor 0 은 이벤트가 없어도 최소 EXIT_FLAG_POLL_MS 마다 깨어나 확인하며, true면 루프를 탈출한다.
+     *   (어느 스레드에서 세워도 그 시간 안에 반영됨) 시그널 핸들러나 다른 스레드에서 즉시 멈추려면 Stop 을 호출한다.
+     *   Stop 만 쓴다면 NULL 을 넘겨 유휴 상태에서 주기적으로 깨어나지 않게 할 수 있다.
      */
     void ( *Run )( TcpServerContext* ctx, volatile bool* exit_flag );
 
     /**
-     * ##   특정 클라이언트에게 데이터를 전송하도록 큐에 작업을 등록한다.
-     * #### 실제 전송은 Sender 스레드에서 비동기로 처리된다.
+     * ##   Run 루프를 깨워 탈출시킨다. (Thread-Safe, 시그널 핸들러에서도 호출 가능)
+     * #### 플래그를 세우고 각 Reactor의 eventfd 에 쓰기만 하므로 즉시 반환한다. 자원 해제는 Destroy 에서 한다.
+     */
+    void ( *Stop )( TcpServerContext* ctx );
+
+    /**
+     * ##   특정 클라이언트에게 데이터를 전송한다. (Non-blocking)
+     * #### 그 연결 앞으로 밀린 요청이 없으면 호출한 스레드에서 바로 소켓에 쓴다. (소켓이 가득 차면 나머지는 Reactor가 이어 보냄)
+     * #### 밀린 요청이 있으면 순서를 지키기 위해 큐에 등록하고, Sender 스레드가 비동기로 처리한다.
      *
      * ### [Params]
      * - ctx       : 서버 컨텍스트
-     * - client_fd : 수신할 클라이언트 소켓 FD
+     * - conn      : 수신할 연결 핸들 (전송 전에 연결이 끊겼으면 조용히 버려짐)
      * - target    : 패킷 타겟 문자열
      * - body      : 전송할 데이터 구조체 또는 버퍼
      * - len       : 데이터 길이
      *
      * ### [Return]
-     * - true: 큐 등록 성공, false: 실패 (큐 가득 참 등)
+     * - true: 전송 또는 큐 등록 성공, false: 실패 (연결 없음, 큐/송신 대기열 가득 참 등)
+     */
+    bool ( *Send )( TcpServerContext* ctx, ConnHandle conn, const char* target, void* body, int len );
+
+    /**
+     * ##   호출자의 힙 버퍼 소유권을 넘겨받아 복사 없이 전송한다.
+     * #### 전송이 끝나면 release_fn( body ) 로 해제한다. (바로 쓴 경우 이 함수 안에서, 큐를 거친 경우 송신 스레드에서)
+     * #### 실패한 경우에도 소유권은 넘어가며, 이 함수 안에서 즉시 해제된다. (호출 후 body 사용 금지)
+     *
+     * ### [Params]
+     * - ctx        : 서버 컨텍스트
+     * - conn       : 수신할 연결 핸들
+     * - target     : 패킷 타겟 문자열
+     * - body       : 전송할 힙 버퍼 (전송 완료 전까지 수정하면 안 됨)
+     * - len        : 데이터 길이
+     * - release_fn : body 해제 함수 (NULL이면 free)
+     *
+     * ### [Return]
+     * - true: 전송 또는 큐 등록 성공, false: 실패 (큐 가득 참 등)
+     */
+    bool ( *SendOwned )( TcpServerContext* ctx, ConnHandle conn, const char* target,
+                         void* body, int len, ReleaseBodyFunc release_fn );
+
+    /**
+     * ##   참조 카운트 버퍼를 복사 없이 전송한다.
+     * #### 성공 시 라이브러리가 참조를 하나 더 잡고, 전송이 끝나면 놓는다. 호출자의 참조는 그대로 남는다.
+     * #### 같은 버퍼를 여러 클라이언트에게 보낼 때 유용하다. (공유 중에는 내용을 수정하면 안 됨)
+     *
+     * ### [Params]
+     * - ctx       : 서버 컨텍스트
+     * - conn      : 수신할 연결 핸들
+     * - target    : 패킷 타겟 문자열
+     * - body      : 전송할 버퍼 (body->data 의 body->len 바이트)
+     *
+     * ### [Return]
+     * - true: 전송 또는 큐 등록 성공, false: 실패
+     *
+     * ### [Example]
+     * - SharedBuffer* buf = SharedBuffer_Create( sizeof( ChatPacket ) );
+     * - memcpy( buf->data, &pkt, sizeof( pkt ) ); buf->len = sizeof( pkt );
+     * - ctx->SendRef( ctx, conn_a, TARGET_APP_CHAT, buf );
+     * - ctx->SendRef( ctx, conn_b, TARGET_APP_CHAT, buf );
+     * - SharedBuffer_Release( buf );
      */
-    bool ( *Send )( TcpServerContext* ctx, int client_fd, const char* target, void* body, int len );
+    bool ( *SendRef )( TcpServerContext* ctx, ConnHandle conn, const char* target, SharedBuffer* body );
 
     /**
      * ##   현재 접속된 모든 클라이언트에게 데이터를 전송한다. (Broadcast)
@@ -166,6 +434,76 @@ struct TcpServerContext
      */
     bool ( *Broadcast )( TcpServerContext* ctx, const char* target, void* body, int len );
 
+    /**
+     * ##   연결의 송신을 묶기 시작한다. (Thread-Safe, 중첩 가능)
+     * #### Uncork 전까지 그 연결로 가는 프레임은 바로 보내지 않고 모았다가, 가장 바깥 Uncork 에서 한 번의 sendmsg 로 보낸다.
+     * #### 모인 양이 send_coalesce_bytes 에 닿으면 그 전에 보낸다. 반드시 Uncork 를 짝지어 호출해야 한다.
+     *
+     * ### [Params]
+     * - ctx  : 서버 컨텍스트
+     * - conn : 대상 연결 핸들
+     *
+     * ### [Return]
+     * - true: 성공, false: 연결 없음
+     *
+     * ### [Example]
+     * - ctx->Cork( ctx, conn );
+     * - ctx->Send( ctx, conn, "A", &a, sizeof( a ) );
+     * - ctx->Send( ctx, conn, "B", &b, sizeof( b ) );
+     * - ctx->Uncork( ctx, conn ); // A, B 를 한 번에 전송
+     */
+    bool ( *Cork )( TcpServerContext* ctx, ConnHandle conn );
+
+    /**
+     * ## Cork 를 하나 해제하고, 가장 바깥 Uncork 면 모아둔 프레임을 보낸다. (Thread-Safe)
+     */
+    void ( *Uncork )( TcpServerContext* ctx, ConnHandle conn );
+
+    /**
+     * ##   delay_ms 뒤에 한 번 callback 을 실행한다. (Thread-Safe, 콜백 안에서도 호출 가능)
+     * #### 콜백은 워커 0 에서 메시지 처리와 같은 큐를 거쳐 실행된다. (추가 스레드 없음)
+     * #### 타이머 휠은 Reactor 0 이 돌리므로 Run 이 실행 중일 때만 만료된다.
+     *
+     * ### [Params]
+     * - ctx      : 서버 컨텍스트
+     * - delay_ms : 지연 시간 (밀리초, 0 이하이면 다음 루프에서 실행)
+     * - callback : 만료 시 호출할 함수
+     * - arg      : callback 에 넘길 인자
+     *
+     * ### [Return]
+     * - 타이머 ID (실패 시 SERVER_TIMER_INVALID). 실행이 끝나면 자동으로 해제된다.
+     */
+    ServerTimerId ( *ScheduleTimer )( TcpServerContext* ctx, int delay_ms, OnServerTimerCallback callback, void* arg );
+
+    /**
+     * ##   interval_ms 마다 callback 을 실행한다. (Thread-Safe, 고정 주기)
+     * #### 만료 시각은 이전 만료 시각에 interval_ms 를 더해 정하므로 실행 시간이 쌓여 밀리지 않는다.
+     * #### 이전 실행이 아직 워커에서 끝나지 않았으면 그 회차는 건너뛴다. (큐에 쌓이지 않음)
+     *
+     * ### [Params]
+     * - ctx         : 서버 컨텍스트
+     * - interval_ms : 주기 (밀리초, 1 이상)
+     * - callback    : 만료 시 호출할 함수
+     * - arg         : callback 에 넘길 인자
+     *
+     * ### [Return]
+     * - 타이머 ID (실패 시 SERVER_TIMER_INVALID). CancelTimer 로 멈출 때까지 계속 실행된다.
+     *
+     * ### [Example]
+     * - // 20Hz 상태 브로드캐스트
+     * - ctx->SchedulePeriodic( ctx, 50, OnTick, NULL );
+     */
+    ServerTimerId ( *SchedulePeriodic )( TcpServerContext* ctx, int interval_ms, OnServerTimerCallback callback, void* arg );
+
+    /**
+     * ##   타이머를 취소한다. (Thread-Safe, 자신의 콜백 안에서도 호출 가능)
+     * #### 반환 이후 새 실행은 시작되지 않는다. (이미 실행 중인 콜백은 끝까지 실행됨)
+     *
+     * ### [Return]
+     * - true: 취소함, false: 없는 ID (이미 실행이 끝난 일회성 타이머 포함)
+     */
+    bool ( *CancelTimer )( TcpServerContext* ctx, ServerTimerId id );
+
     /**
      * ## 암호화/복호화 전략을 설정한다.
      *
@@ -189,6 +527,41 @@ struct TcpServerContext
      * ## 현재 접속 중인 클라이언트(FD)의 개수를 반환한다.
      */
     int ( *GetClientCount )( TcpServerContext* ctx );
+
+    /**
+     * ##   수신 태스크 풀의 사용 현황을 조회한다. (recv_pool_blocks 조정용)
+     * #### miss_count 가 계속 늘어난다면 풀이 작은 것이다.
+     *
+     * ### [Params]
+     * - ctx : 서버 컨텍스트
+     * - out : 결과를 채울 구조체
+     */
+    void ( *GetRecvPoolStats )( TcpServerContext* ctx, BufferPoolStats* out );
+
+    /**
+     * ## 송신 태스크 풀의 사용 현황을 조회한다. (send_pool_blocks 조정용)
+     */
+    void ( *GetSendPoolStats )( TcpServerContext* ctx, BufferPoolStats* out );
+
+    /**
+     * ##   수신 Backpressure(워터마크에 의한 읽기 중단/재개) 현황을 조회한다.
+     * #### pause_count 가 자주 늘어난다면 워커가 처리량을 따라가지 못하는 것이다. (worker_count 조정)
+     *
+     * ### [Params]
+     * - ctx : 서버 컨텍스트
+     * - out : 결과를 채울 구조체
+     */
+    void ( *GetBackpressureStats )( TcpServerContext* ctx, ServerBackpressureStats* out );
+
+    /**
+     * ##   송수신 카운터와 큐 현황을 조회한다. (Lock-Free, 스레드별 카운터를 합친 스냅샷)
+     * #### 바이트/프레임 수, PacketResult 별 파싱 실패, 큐 깊이와 최고 기록, Drop, 부분 전송, 수락/종료 수를 채운다.
+     *
+     * ### [Params]
+     * - ctx : 서버 컨텍스트
+     * - out : 결과를 채울 구조체
+     */
+    void ( *GetStats )( TcpServerContext* ctx, TcpStats* out );
 };
 
 
@@ -209,4 +582,28 @@ struct TcpServerContext
  */
 TcpServerContext* CreateTcpServerContext( OnServerMessageCallback callback, void* service_ctx );
 
+/**
+ * ## 구성값을 지정하여 TcpServerContext 객체를 생성한다.
+ *
+ * ### [Param]
+ * - callback     : 메시지 수신 시 처리할 콜백 함수
+ * - service_ctx  : 콜백에 전달될 사용자 데이터 컨텍스트
+ * - config       : 서버 구성값 (NULL이면 기본값)
+ *
+ * ### [Return]
+ * - 생성된 객체 포인터 (실패 시 NULL)
+ *
+ * ### [Example]
+ * - TcpServerConfig config = TcpServer_GetDefaultConfig();
+ * - config.reactor_count = 4;
+ * - TcpServerContext* server = CreateTcpServerContextEx( OnMessage, &app, &config );
+ */
+TcpServerContext* CreateTcpServerContextEx( OnServerMessageCallback callback, void* service_ctx,
+                                            const TcpServerConfig* config );
+
+/**
+ * ## TcpServerConfig 기본값을 반환한다.
+ */
+TcpServerConfig TcpServer_GetDefaultConfig( void );
+
 #endif // TCP_SERVER_H
\ No newline at end of file
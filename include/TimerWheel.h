@@ -0,0 +1,114 @@
+/**
+ * 파일명: include/TimerWheel.h
+ *
+ * 개요:
+ * 계층형 타이머 휠(Hierarchical Timing Wheel) 선언.
+ * 타이머 등록/취소는 O(1)이며, 연결마다 타이머를 하나씩 두어도 시스템 콜(timerfd 등)이 필요 없다.
+ * 이벤트 루프가 루프마다 현재 시각으로 Advance 를 호출하면 만료된 타이머의 콜백이 그 자리에서 실행된다.
+ *
+ * 주의: Thread-Safe 하지 않다. 휠을 소유한 스레드(예: Reactor) 하나에서만 사용해야 한다.
+ */
+
+#ifndef TIMER_WHEEL_H
+#define TIMER_WHEEL_H
+
+#include <stdint.h>  // uint64_t
+#include <stdbool.h> // bool
+
+// --------------------------------------------------------------------------
+// 1. 타입 정의
+// --------------------------------------------------------------------------
+
+typedef struct TimerWheel TimerWheel;
+
+/**
+ * ## [TimerFunc]
+ * 타이머가 만료되었을 때 호출되는 함수. (Advance 를 호출한 스레드에서 실행)
+ * 콜백 안에서 같은 휠에 타이머를 다시 등록하거나 다른 타이머를 취소해도 된다.
+ */
+typedef void ( *TimerFunc )( void* arg );
+
+/**
+ * ## [TimerEntry]
+ * 타이머 하나. 사용하는 쪽의 구조체 안에 넣어 두고(Intrusive) 휠에는 포인터만 연결한다.
+ * TimerEntry_Init 으로 초기화한 뒤 사용하며, 필드는 직접 수정하지 않는다.
+ */
+typedef struct TimerEntry
+{
+    struct TimerEntry* prev;
+    struct TimerEntry* next;   // NULL 이면 등록되지 않은 상태
+    uint64_t           expire; // 만료 틱
+
+    TimerFunc callback;
+    void*     arg;
+} TimerEntry;
+
+
+// --------------------------------------------------------------------------
+// 2. 함수 선언
+// --------------------------------------------------------------------------
+
+/**
+ * ##   타이머 휠을 생성한다.
+ *
+ * ### [Params]
+ * - tick_ms : 틱 하나의 길이 (밀리초, 타이머 정밀도). 0 이하이면 1
+ * - now_ms  : 현재 시각 (단조 증가 시계, 밀리초)
+ *
+ * ### [Return]
+ * - 생성된 휠 (실패 시 NULL)
+ */
+TimerWheel* TimerWheel_Create( int tick_ms, uint64_t now_ms );
+
+/**
+ * ##   휠을 해제한다.
+ * #### 등록된 타이머의 콜백은 호출하지 않는다. (TimerEntry 는 사용하는 쪽이 해제)
+ */
+void TimerWheel_Destroy( TimerWheel* wheel );
+
+/**
+ * ## 타이머를 쓰기 전에 콜백과 인자를 지정한다. (등록되지 않은 상태로 초기화)
+ */
+void TimerEntry_Init( TimerEntry* entry, TimerFunc callback, void* arg );
+
+/**
+ * ##   타이머가 휠에 등록되어 있는지 확인한다.
+ */
+bool TimerEntry_IsActive( const TimerEntry* entry );
+
+/**
+ * ##   now_ms 로부터 delay_ms 뒤에 만료되도록 타이머를 등록한다. (O(1))
+ * #### 이미 등록된 타이머면 기존 예약을 취소하고 새로 등록한다.
+ * #### 만료 시각은 틱 단위로 올림되며, 이미 지난 시각이면 다음 Advance 에서 만료된다.
+ */
+void TimerWheel_Schedule( TimerWheel* wheel, TimerEntry* entry, uint64_t now_ms, uint64_t delay_ms );
+
+/**
+ * ## 타이머 등록을 취소한다. (O(1), 등록되지 않은 타이머면 아무것도 하지 않음)
+ */
+void TimerWheel_Cancel( TimerWheel* wheel, TimerEntry* entry );
+
+/**
+ * ##   now_ms 까지 만료된 타이머의 콜백을 실행한다.
+ * #### 지난 틱마다 해당 칸만 확인하고, 상위 단계 칸은 하위 단계가 한 바퀴 돌 때마다 내려보낸다.
+ *
+ * ### [Return]
+ * - 실행한 콜백 수
+ */
+int TimerWheel_Advance( TimerWheel* wheel, uint64_t now_ms );
+
+/**
+ * ##   다음 Advance 가 필요할 때까지 남은 시간(밀리초)을 구한다. (이벤트 대기 타임아웃용)
+ * #### 최하위 단계에서 가장 가까운 타이머를 찾고, 없으면 상위 단계 칸을 내려보낼 시각을 반환한다.
+ *
+ * ### [Return]
+ * - 남은 시간 (0: 바로 Advance 필요, -1: 등록된 타이머 없음)
+ */
+int TimerWheel_NextTimeout( TimerWheel* wheel, uint64_t now_ms );
+
+/**
+ * ## 등록된 타이머 수
+ */
+int TimerWheel_Count( TimerWheel* wheel );
+
+#endif // TIMER_WHEEL_H
@@ -0,0 +1,434 @@
+/**
+ * 파일명: src/BufferPool.c
+ *
+ * 개요:
+ * BufferPool.h 에 선언된 고정 크기 블록 풀 구현부.
+ *
+ * [구조]
+ * - 블록 = [BlockHeader][사용자 영역 block_size]. 헤더에 소속 풀을 기록해 Free 시 풀 인자가 필요 없다.
+ * - Slab   : POOL_SLAB_BLOCKS 개의 블록을 한 번에 할당한 덩어리. 풀 파괴 시 한꺼번에 해제한다.
+ * - 스레드 캐시: 스레드마다 POOL_CACHE_SLOTS 개의 풀에 대해 최대 POOL_CACHE_BLOCKS 개씩 블록을 보관한다.
+ *   캐시가 비면 풀에서 절반을 채워오고, 가득 차면 절반을 풀로 돌려준다. (Lock은 이때만 사용)
+ */
+
+#include "BufferPool.h"
+
+#include <stdio.h>   // NULL
+#include <stdlib.h>  // malloc, free
+#include <string.h>  // memset
+#include <pthread.h> // pthread_mutex_* (빈 블록 리스트 보호)
+
+// --------------------------------------------------------------------------
+// 내부 구조체 정의
+// --------------------------------------------------------------------------
+
+#define POOL_HEADER_SIZE  32 // 블록 헤더 크기 (사용자 영역을 16바이트 경계에 맞춤)
+#define POOL_SLAB_BLOCKS  64 // Slab 하나에 담는 블록 수
+#define POOL_CACHE_SLOTS  4  // 스레드 하나가 동시에 캐시하는 풀 수
+#define POOL_CACHE_BLOCKS 32 // 풀 하나당 스레드 캐시 최대 블록 수
+
+typedef struct BlockHeader
+{
+    BufferPool*         pool;    // 소속 풀
+    struct BlockHeader* next;    // 빈 블록 리스트 연결 (대여 중에는 미사용)
+    int                 is_heap; // 풀이 가득 차 힙에서 따로 할당된 블록
+} BlockHeader;
+
+typedef struct Slab
+{
+    struct Slab* next;
+} Slab;
+
+struct BufferPool
+{
+    uint64_t id; // 풀 고유 번호 (같은 주소에 새 풀이 생겨도 스레드 캐시가 구분할 수 있도록)
+
+    int block_size;
+    int stride;   // POOL_HEADER_SIZE + block_size (16바이트 정렬)
+    int capacity;
+
+    pthread_mutex_t mutex;        // 아래 필드 보호
+    BlockHeader*    free_list;    // 빈 블록 리스트
+    int             free_count;
+    int             total_blocks;
+    Slab*           slabs;        // 할당한 Slab 목록 (파괴 시 해제)
+
+    int      heap_blocks; // (atomic) 반납되지 않은 힙 블록 수
+    uint64_t miss_count;  // (atomic) 힙 할당 누적 횟수
+
+    struct BufferPool* live_next; // 살아있는 풀 목록 연결 (g_live_mutex 보호)
+};
+
+/**
+ * 스레드 하나가 풀 하나에 대해 보관하는 블록 캐시
+ */
+typedef struct
+{
+    BufferPool*  pool;
+    uint64_t     pool_id;
+    int          count;
+    BlockHeader* blocks[POOL_CACHE_BLOCKS];
+} ThreadCache;
+
+static __thread ThreadCache tls_caches[POOL_CACHE_SLOTS];
+static __thread uint64_t    tls_destroy_seen; // 마지막으로 캐시를 정리했을 때의 g_destroy_count
+
+static uint64_t g_next_pool_id = 1;
+
+// 살아있는 풀 목록. 스레드 캐시에 남은 파괴된 풀의 슬롯을 가려낼 때만 조회한다.
+static pthread_mutex_t g_live_mutex    = PTHREAD_MUTEX_INITIALIZER;
+static BufferPool*     g_live_pools    = NULL;
+static uint64_t        g_destroy_count = 0; // (atomic) 파괴된 풀 누적 수
+
+
+// --------------------------------------------------------------------------
+// 내부 함수
+// --------------------------------------------------------------------------
+
+static inline BlockHeader* HeaderOf( void* block )
+{
+    return (BlockHeader*)( (char*)block - POOL_HEADER_SIZE );
+}
+
+static inline void* BlockOf( BlockHeader* header )
+{
+    return (char*)header + POOL_HEADER_SIZE;
+}
+
+/**
+ * ## 현재 스레드의 캐시 중 이미 파괴된 풀의 슬롯을 비운다. 비운 슬롯 하나를 반환한다. (없으면 NULL)
+ * 파괴된 풀의 블록은 Slab 과 함께 이미 해제되었으므로 버리기만 한다. (cache->pool 역참조 금지)
+ * 마지막 정리 이후 파괴된 풀이 없으면 Lock 없이 바로 NULL 을 반환한다.
+ */
+static ThreadCache* ReclaimStaleCaches( void )
+{
+    uint64_t destroyed = __atomic_load_n( &g_destroy_count, __ATOMIC_ACQUIRE );
+    if( destroyed == tls_destroy_seen )
+        return NULL;
+
+    tls_destroy_seen = destroyed;
+
+    ThreadCache* empty = NULL;
+
+    pthread_mutex_lock( &g_live_mutex );
+
+    for( int i = 0; i < POOL_CACHE_SLOTS; ++i )
+    {
+        ThreadCache* cache = &tls_caches[i];
+        int          live  = 0;
+
+        for( BufferPool* p = g_live_pools; p; p = p->live_next )
+        {
+            if( p->id == cache->pool_id ){
+                live = 1;
+                break;
+            }
+        }
+
+        if( !live )
+        {
+            cache->pool  = NULL;
+            cache->count = 0;
+
+            if( !empty )
+                empty = cache;
+        }
+    }
+
+    pthread_mutex_unlock( &g_live_mutex );
+
+    return empty;
+}
+
+/**
+ * ## 현재 스레드의 캐시 중 이 풀의 것을 찾는다. 없으면 빈 슬롯을 배정한다.
+ * 배정할 슬롯이 없으면 NULL (이 경우 풀의 리스트를 직접 사용한다)
+ */
+static ThreadCache* FindCache( BufferPool* pool )
+{
+    ThreadCache* empty = NULL;
+
+    for( int i = 0; i < POOL_CACHE_SLOTS; ++i )
+    {
+        ThreadCache* cache = &tls_caches[i];
+
+        if( cache->pool == pool && cache->pool_id == pool->id )
+            return cache;
+
+        // 비어있는 슬롯은 다른 풀(이미 파괴된 풀 포함)의 것이어도 재사용 가능
+        if( !empty && cache->count == 0 )
+            empty = cache;
+    }
+
+    // 모든 슬롯이 차 있으면 파괴된 풀이 남긴 슬롯을 회수한다.
+    // (다른 스레드가 파괴한 풀의 슬롯은 count > 0 인 채로 남아 그냥 두면 영영 재사용되지 않음)
+    if( !empty )
+        empty = ReclaimStaleCaches();
+
+    if( empty )
+    {
+        empty->pool    = pool;
+        empty->pool_id = pool->id;
+    }
+
+    return empty;
+}
+
+/**
+ * ## 빈 블록이 없고 여유가 있으면 Slab 하나를 만들어 빈 블록 리스트에 붙인다. (mutex 보유)
+ */
+static void GrowLocked( BufferPool* pool )
+{
+    int count = pool->capacity - pool->total_blocks;
+    if( count <= 0 )
+        return;
+
+    if( count > POOL_SLAB_BLOCKS )
+        count = POOL_SLAB_BLOCKS;
+
+    Slab* slab = (Slab*)malloc( POOL_HEADER_SIZE + (size_t)pool->stride * count );
+    if( !slab )
+        return;
+
+    slab->next  = pool->slabs;
+    pool->slabs = slab;
+
+    // Slab 헤더 뒤로 블록을 나란히 배치
+    char* base = (char*)slab + POOL_HEADER_SIZE;
+
+    for( int i = 0; i < count; ++i )
+    {
+        BlockHeader* header = (BlockHeader*)( base + (size_t)pool->stride * i );
+
+        header->pool    = pool;
+        header->is_heap = 0;
+        header->next    = pool->free_list;
+
+        pool->free_list = header;
+    }
+
+    pool->free_count   += count;
+    pool->total_blocks += count;
+}
+
+/**
+ * ## 풀에서 최대 want개의 블록을 꺼내 out 에 담는다. (Lock 1회)
+ * Return: 꺼낸 개수
+ */
+static int TakeFromPool( BufferPool* pool, BlockHeader** out, int want )
+{
+    int taken = 0;
+
+    pthread_mutex_lock( &pool->mutex );
+    {
+        if( pool->free_count < want )
+            GrowLocked( pool );
+
+        while( taken < want && pool->free_list )
+        {
+            out[taken++]    = pool->free_list;
+            pool->free_list = pool->free_list->next;
+        }
+
+        pool->free_count -= taken;
+    }
+    pthread_mutex_unlock( &pool->mutex );
+
+    return taken;
+}
+
+/**
+ * ## 블록들을 풀의 빈 블록 리스트로 돌려준다. (Lock 1회)
+ */
+static void ReturnToPool( BufferPool* pool, BlockHeader** blocks, int count )
+{
+    pthread_mutex_lock( &pool->mutex );
+    {
+        for( int i = 0; i < count; ++i )
+        {
+            blocks[i]->next = pool->free_list;
+            pool->free_list = blocks[i];
+        }
+
+        pool->free_count += count;
+    }
+    pthread_mutex_unlock( &pool->mutex );
+}
+
+
+// --------------------------------------------------------------------------
+// 함수 구현
+// --------------------------------------------------------------------------
+
+BufferPool* BufferPool_Create( int block_size, int capacity )
+{
+    if( block_size <= 0 || capacity <= 0 ){
+        return NULL;
+    }
+
+    BufferPool* pool = (BufferPool*)malloc( sizeof( BufferPool ) );
+    if( !pool ){
+        return NULL;
+    }
+
+    if( pthread_mutex_init( &pool->mutex, NULL ) != 0 ){
+        free( pool );
+        return NULL;
+    }
+
+    pool->id           = __atomic_fetch_add( &g_next_pool_id, 1, __ATOMIC_RELAXED );
+    pool->block_size   = block_size;
+    pool->stride       = POOL_HEADER_SIZE + ( ( block_size + 15 ) & ~15 );
+    pool->capacity     = capacity;
+    pool->free_list    = NULL;
+    pool->free_count   = 0;
+    pool->total_blocks = 0;
+    pool->slabs        = NULL;
+    pool->heap_blocks  = 0;
+    pool->miss_count   = 0;
+
+    pthread_mutex_lock( &g_live_mutex );
+    pool->live_next = g_live_pools;
+    g_live_pools    = pool;
+    pthread_mutex_unlock( &g_live_mutex );
+
+    return pool;
+}
+
+void BufferPool_Destroy( BufferPool* pool )
+{
+    if( !pool )
+        return;
+
+    // 살아있는 풀 목록에서 빼고 파괴 수를 올린다. (다른 스레드는 슬롯이 모자랄 때 이를 보고 자기 캐시를 정리함)
+    pthread_mutex_lock( &g_live_mutex );
+    for( BufferPool** link = &g_live_pools; *link; link = &( *link )->live_next )
+    {
+        if( *link == pool ){
+            *link = pool->live_next;
+            break;
+        }
+    }
+    __atomic_fetch_add( &g_destroy_count, 1, __ATOMIC_RELEASE );
+    pthread_mutex_unlock( &g_live_mutex );
+
+    // 호출 스레드의 캐시는 바로 비워둔다.
+    for( int i = 0; i < POOL_CACHE_SLOTS; ++i )
+    {
+        if( tls_caches[i].pool == pool && tls_caches[i].pool_id == pool->id )
+        {
+            tls_caches[i].pool  = NULL;
+            tls_caches[i].count = 0;
+        }
+    }
+
+    Slab* slab = pool->slabs;
+    while( slab )
+    {
+        Slab* next = slab->next;
+        free( slab );
+        slab = next;
+    }
+
+    pthread_mutex_destroy( &pool->mutex );
+    free( pool );
+}
+
+void* BufferPool_Alloc( BufferPool* pool )
+{
+    if( !pool )
+        return NULL;
+
+    ThreadCache* cache = FindCache( pool );
+
+    // 1. Fast Path: 스레드 캐시 (Lock 없음)
+    if( cache && cache->count > 0 )
+        return BlockOf( cache->blocks[--cache->count] );
+
+    // 2. 풀에서 캐시 절반만큼 채워온다. (캐시가 없으면 1개만)
+    if( cache )
+    {
+        cache->count = TakeFromPool( pool, cache->blocks, POOL_CACHE_BLOCKS / 2 );
+        if( cache->count > 0 )
+            return BlockOf( cache->blocks[--cache->count] );
+    }
+    else
+    {
+        BlockHeader* header = NULL;
+        if( TakeFromPool( pool, &header, 1 ) == 1 )
+            return BlockOf( header );
+    }
+
+    // 3. Miss: 풀이 가득 참 -> 힙에서 따로 할당 (반납 시 바로 해제)
+    BlockHeader* header = (BlockHeader*)malloc( POOL_HEADER_SIZE + pool->block_size );
+    if( !header )
+        return NULL;
+
+    header->pool    = pool;
+    header->next    = NULL;
+    header->is_heap = 1;
+
+    __atomic_fetch_add( &pool->heap_blocks, 1, __ATOMIC_RELAXED );
+    __atomic_fetch_add( &pool->miss_count,  1, __ATOMIC_RELAXED );
+
+    return BlockOf( header );
+}
+
+void BufferPool_Free( void* block )
+{
+    if( !block )
+        return;
+
+    BlockHeader* header = HeaderOf( block );
+    BufferPool*  pool   = header->pool;
+
+    if( header->is_heap )
+    {
+        __atomic_fetch_sub( &pool->heap_blocks, 1, __ATOMIC_RELAXED );
+        free( header );
+        return;
+    }
+
+    ThreadCache* cache = FindCache( pool );
+
+    if( !cache )
+    {
+        ReturnToPool( pool, &header, 1 );
+        return;
+    }
+
+    // 캐시가 가득 찼으면 절반을 풀로 돌려 다른 스레드가 쓸 수 있게 한다.
+    // (Reactor가 빌리고 Worker가 반납하는 식으로 흐름이 한쪽으로 쏠려도 블록이 한 스레드에 고이지 않음)
+    if( cache->count == POOL_CACHE_BLOCKS )
+    {
+        cache->count -= POOL_CACHE_BLOCKS / 2;
+        ReturnToPool( pool, &cache->blocks[cache->count], POOL_CACHE_BLOCKS / 2 );
+    }
+
+    cache->blocks[cache->count++] = header;
+}
+
+void BufferPool_GetStats( BufferPool* pool, BufferPoolStats* out )
+{
+    if( !out )
+        return;
+
+    memset( out, 0, sizeof( BufferPoolStats ) );
+
+    if( !pool )
+        return;
+
+    out->block_size = pool->block_size;
+    out->capacity   = pool->capacity;
+
+    pthread_mutex_lock( &pool->mutex );
+    {
+        out->total_blocks = pool->total_blocks;
+        out->free_blocks  = pool->free_count;
+    }
+    pthread_mutex_unlock( &pool->mutex );
+
+    out->used_blocks = out->total_blocks - out->free_blocks;
+    out->heap_blocks = __atomic_load_n( &pool->heap_blocks, __ATOMIC_RELAXED );
+    out->miss_count  = __atomic_load_n( &pool->miss_count,  __ATOMIC_RELAXED );
+}
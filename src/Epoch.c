@@ -0,0 +1,263 @@
+/**
+ * 파일명: src/Epoch.c
+ *
+ * 개요:
+ * Epoch.h 에 선언된 Epoch 기반 지연 해제 구현부.
+ *
+ * [구조]
+ * - 전역 Epoch 카운터와 EPOCH_SLOTS 개의 읽기 슬롯. 읽기 구간에 들어간 스레드는 빈 슬롯 하나에
+ *   자신이 본 전역 Epoch를 기록하고, 나올 때 0으로 되돌린다. (스레드 등록 절차 없음)
+ * - 전역 Epoch는 사용 중인 모든 슬롯이 현재 Epoch를 기록하고 있을 때만 1 증가한다.
+ * - Epoch e 에 Retire 된 객체는 전역 Epoch가 e + 2 이상이 되면 어떤 읽기 구간에서도 보이지 않으므로 해제한다.
+ */
+
+#include "Epoch.h"
+
+#include <stdint.h>  // uint64_t
+#include <stdbool.h> // bool, false
+#include <stdlib.h>  // malloc, free
+#include <pthread.h> // pthread_mutex_* (Retire 목록 보호)
+#include <sched.h>   // sched_yield
+
+// --------------------------------------------------------------------------
+// 내부 구조체 정의
+// --------------------------------------------------------------------------
+
+#define EPOCH_SLOTS      64 // 동시에 읽기 구간에 있을 수 있는 최대 수 (넘치면 빈 슬롯이 생길 때까지 대기)
+#define EPOCH_CACHE_LINE 64
+
+/**
+ * 읽기 슬롯 하나 (0: 비어있음, 그 외: 구간에 들어갈 때 본 전역 Epoch)
+ * 슬롯마다 캐시 라인을 따로 써서 서로 다른 스레드의 Enter/Exit 가 간섭하지 않게 한다.
+ */
+typedef struct
+{
+    uint64_t epoch;
+    char     pad[EPOCH_CACHE_LINE - sizeof( uint64_t )];
+} EpochSlot;
+
+typedef struct Retired
+{
+    void*           ptr;
+    EpochFreeFunc   free_fn;
+    uint64_t        epoch; // Retire 시점의 전역 Epoch
+    struct Retired* next;
+} Retired;
+
+struct EpochDomain
+{
+    uint64_t  global; // (atomic) 전역 Epoch (1부터 시작)
+    EpochSlot slots[EPOCH_SLOTS];
+
+    pthread_mutex_t mutex;   // 아래 필드 보호
+    Retired*        head;    // 가장 오래된 Retire 객체 (Epoch 오름차순)
+    Retired*        tail;
+    int             pending; // (atomic) 해제 대기 객체 수
+};
+
+// 스레드마다 마지막으로 사용한 슬롯 (다음 Enter 가 같은 슬롯부터 찾도록)
+static __thread unsigned tls_slot_hint;
+static __thread int      tls_slot_hint_set;
+
+static unsigned g_next_slot_hint = 0;
+
+
+// --------------------------------------------------------------------------
+// 내부 함수
+// --------------------------------------------------------------------------
+
+/**
+ * ## 모든 읽기 구간이 현재 Epoch에 있으면 전역 Epoch를 1 올린다. (mutex 보유)
+ * Return: 갱신 후 전역 Epoch
+ */
+static uint64_t TryAdvanceLocked( EpochDomain* domain )
+{
+    uint64_t global = __atomic_load_n( &domain->global, __ATOMIC_SEQ_CST );
+
+    for( int i = 0; i < EPOCH_SLOTS; ++i )
+    {
+        uint64_t e = __atomic_load_n( &domain->slots[i].epoch, __ATOMIC_SEQ_CST );
+        if( e != 0 && e != global )
+            return global; // 이전 Epoch에 머문 읽기 구간이 있음
+    }
+
+    __atomic_store_n( &domain->global, global + 1, __ATOMIC_SEQ_CST );
+    return global + 1;
+}
+
+/**
+ * ## 유예 기간이 끝난 객체를 목록에서 떼어낸다. (mutex 보유, 해제는 호출자가 Lock 밖에서 수행)
+ */
+static Retired* DetachExpiredLocked( EpochDomain* domain, uint64_t global )
+{
+    Retired* expired = NULL;
+    Retired* last    = NULL;
+    int      count   = 0;
+
+    while( domain->head && domain->head->epoch + 2 <= global )
+    {
+        Retired* node = domain->head;
+        domain->head  = node->next;
+        node->next    = NULL;
+
+        if( last ) last->next = node;
+        else       expired    = node;
+
+        last = node;
+        count++;
+    }
+
+    if( !domain->head )
+        domain->tail = NULL;
+
+    __atomic_sub_fetch( &domain->pending, count, __ATOMIC_RELAXED );
+    return expired;
+}
+
+static void FreeRetiredList( Retired* node )
+{
+    while( node )
+    {
+        Retired* next = node->next;
+        node->free_fn( node->ptr );
+        free( node );
+        node = next;
+    }
+}
+
+
+// --------------------------------------------------------------------------
+// 함수 구현
+// --------------------------------------------------------------------------
+
+EpochDomain* Epoch_Create( void )
+{
+    EpochDomain* domain = (EpochDomain*)calloc( 1, sizeof( EpochDomain ) );
+    if( !domain ){
+        return NULL;
+    }
+
+    if( pthread_mutex_init( &domain->mutex, NULL ) != 0 ){
+        free( domain );
+        return NULL;
+    }
+
+    domain->global = 1;
+    return domain;
+}
+
+void Epoch_Destroy( EpochDomain* domain )
+{
+    if( !domain )
+        return;
+
+    FreeRetiredList( domain->head );
+
+    pthread_mutex_destroy( &domain->mutex );
+    free( domain );
+}
+
+int Epoch_Enter( EpochDomain* domain )
+{
+    if( !tls_slot_hint_set )
+    {
+        // 스레드마다 다른 슬롯에서 시작해 Enter 끼리의 충돌을 줄인다.
+        tls_slot_hint     = __atomic_fetch_add( &g_next_slot_hint, 1, __ATOMIC_RELAXED );
+        tls_slot_hint_set = 1;
+    }
+
+    for( ;; )
+    {
+        for( int i = 0; i < EPOCH_SLOTS; ++i )
+        {
+            int        index = (int)( ( tls_slot_hint + i ) % EPOCH_SLOTS );
+            EpochSlot* slot  = &domain->slots[index];
+
+            if( __atomic_load_n( &slot->epoch, __ATOMIC_RELAXED ) != 0 )
+                continue;
+
+            uint64_t expected = 0;
+            uint64_t global   = __atomic_load_n( &domain->global, __ATOMIC_SEQ_CST );
+
+            // 슬롯 기록이 이후의 공유 포인터 읽기보다 먼저 보이도록 SEQ_CST (Full Barrier)
+            if( __atomic_compare_exchange_n( &slot->epoch, &expected, global, false,
+                                             __ATOMIC_SEQ_CST, __ATOMIC_RELAXED ) )
+            {
+                tls_slot_hint = (unsigned)index;
+                return index;
+            }
+        }
+
+        sched_yield(); // 슬롯이 모두 사용 중 (드문 경우)
+    }
+}
+
+void Epoch_Exit( EpochDomain* domain, int slot )
+{
+    __atomic_store_n( &domain->slots[slot].epoch, 0, __ATOMIC_RELEASE );
+}
+
+void Epoch_Retire( EpochDomain* domain, void* ptr, EpochFreeFunc free_fn )
+{
+    Retired* node = (Retired*)malloc( sizeof( Retired ) );
+
+    if( !node )
+    {
+        // 메모리 부족: 유예 기간이 끝날 때까지 직접 기다렸다가 해제한다. (읽기 구간 안에서 호출하면 안 됨)
+        pthread_mutex_lock( &domain->mutex );
+        uint64_t target = __atomic_load_n( &domain->global, __ATOMIC_SEQ_CST ) + 2;
+        while( TryAdvanceLocked( domain ) < target )
+        {
+            pthread_mutex_unlock( &domain->mutex );
+            sched_yield();
+            pthread_mutex_lock( &domain->mutex );
+        }
+        pthread_mutex_unlock( &domain->mutex );
+
+        free_fn( ptr );
+        return;
+    }
+
+    node->ptr     = ptr;
+    node->free_fn = free_fn;
+    node->next    = NULL;
+
+    Retired* expired = NULL;
+
+    pthread_mutex_lock( &domain->mutex );
+    {
+        node->epoch = __atomic_load_n( &domain->global, __ATOMIC_SEQ_CST );
+
+        if( domain->tail ) domain->tail->next = node;
+        else               domain->head       = node;
+        domain->tail = node;
+
+        __atomic_add_fetch( &domain->pending, 1, __ATOMIC_RELAXED );
+
+        expired = DetachExpiredLocked( domain, TryAdvanceLocked( domain ) );
+    }
+    pthread_mutex_unlock( &domain->mutex );
+
+    FreeRetiredList( expired );
+}
+
+void Epoch_Collect( EpochDomain* domain )
+{
+    if( !domain || __atomic_load_n( &domain->pending, __ATOMIC_RELAXED ) == 0 )
+        return;
+
+    // 다른 스레드가 이미 정리 중이면 맡긴다.
+    if( pthread_mutex_trylock( &domain->mutex ) != 0 )
+        return;
+
+    Retired* expired = DetachExpiredLocked( domain, TryAdvanceLocked( domain ) );
+
+    pthread_mutex_unlock( &domain->mutex );
+
+    FreeRetiredList( expired );
+}
+
+bool Epoch_HasPending( EpochDomain* domain )
+{
+    return domain && __atomic_load_n( &domain->pending, __ATOMIC_RELAXED ) != 0;
+}
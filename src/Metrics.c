@@ -0,0 +1,136 @@
+/**
+ * 파일명: src/Metrics.c
+ *
+ * 개요:
+ * Metrics.h 에 선언된 카운터 레지스트리 구현부.
+ *
+ * [구조]
+ * - METRICS_SLOTS 개의 카운터 슬롯. 슬롯마다 캐시 라인 경계에 맞춰 METRIC_COUNT 개의 카운터를 둔다.
+ * - 스레드는 처음 더할 때 전역 카운터로 슬롯 번호를 하나 받아 계속 그 슬롯에만 더한다. (스레드 등록 절차 없음)
+ *   스레드가 슬롯 수보다 많으면 슬롯을 나눠 쓰므로, 더하기는 Relaxed 원자 연산으로 한다. (나눠 쓰지 않으면 캐시 라인이 옮겨 다니지 않음)
+ * - 조회는 모든 슬롯을 Relaxed 로 읽어 합친다.
+ */
+
+#define _POSIX_C_SOURCE 200112L // posix_memalign (모든 헤더보다 먼저 정의해야 함)
+
+#include "Metrics.h"
+
+#include <stdlib.h> // posix_memalign, free
+#include <string.h> // memset
+
+// --------------------------------------------------------------------------
+// 내부 구조체 정의
+// --------------------------------------------------------------------------
+
+#define METRICS_SLOTS      16 // 2의 거듭제곱 (Reactor + 워커 + 송신 스레드 수 정도면 충분)
+#define METRICS_CACHE_LINE 64
+
+#define METRICS_SLOT_BYTES \
+    ( ( METRIC_COUNT * sizeof( uint64_t ) + METRICS_CACHE_LINE - 1 ) / METRICS_CACHE_LINE * METRICS_CACHE_LINE )
+
+/**
+ * 스레드 슬롯 하나. 다른 슬롯과 캐시 라인을 나눠 쓰지 않도록 크기를 캐시 라인 배수로 맞춘다.
+ */
+typedef union
+{
+    uint64_t counters[METRIC_COUNT];
+    char     pad[METRICS_SLOT_BYTES];
+} MetricsSlot;
+
+struct Metrics
+{
+    MetricsSlot slots[METRICS_SLOTS];
+};
+
+// 스레드마다 사용하는 슬롯 번호 (모든 레지스트리에서 공통)
+static __thread unsigned tls_slot;
+static __thread int      tls_slot_set;
+
+static unsigned g_next_slot = 0;
+
+
+// --------------------------------------------------------------------------
+// 내부 함수
+// --------------------------------------------------------------------------
+
+static inline MetricsSlot* SlotOf( Metrics* metrics )
+{
+    if( !tls_slot_set )
+    {
+        tls_slot     = __atomic_fetch_add( &g_next_slot, 1, __ATOMIC_RELAXED ) & ( METRICS_SLOTS - 1 );
+        tls_slot_set = 1;
+    }
+
+    return &metrics->slots[tls_slot];
+}
+
+
+// --------------------------------------------------------------------------
+// 함수 구현
+// --------------------------------------------------------------------------
+
+Metrics* Metrics_Create( void )
+{
+    void* mem = NULL;
+
+    if( posix_memalign( &mem, METRICS_CACHE_LINE, sizeof( Metrics ) ) != 0 ){
+        return NULL;
+    }
+
+    memset( mem, 0, sizeof( Metrics ) );
+    return (Metrics*)mem;
+}
+
+void Metrics_Destroy( Metrics* metrics )
+{
+    free( metrics );
+}
+
+void Metrics_Add( Metrics* metrics, MetricId id, uint64_t value )
+{
+    if( !metrics || id < 0 || id >= METRIC_COUNT )
+        return;
+
+    __atomic_fetch_add( &SlotOf( metrics )->counters[id], value, __ATOMIC_RELAXED );
+}
+
+void Metrics_AddParseError( Metrics* metrics, PacketResult result )
+{
+    if( result <= PKT_SUCCESS || result >= METRICS_PACKET_RESULTS )
+        return;
+
+    Metrics_Add( metrics, (MetricId)( METRIC_PARSE_ERROR + result ), 1 );
+}
+
+void Metrics_GetStats( Metrics* metrics, TcpStats* out )
+{
+    if( !out )
+        return;
+
+    memset( out, 0, sizeof( TcpStats ) );
+
+    if( !metrics )
+        return;
+
+    uint64_t sum[METRIC_COUNT] = { 0 };
+
+    for( int s = 0; s < METRICS_SLOTS; ++s )
+    {
+        for( int i = 0; i < METRIC_COUNT; ++i )
+            sum[i] += __atomic_load_n( &metrics->slots[s].counters[i], __ATOMIC_RELAXED );
+    }
+
+    out->bytes_in   = sum[METRIC_BYTES_IN];
+    out->bytes_out  = sum[METRIC_BYTES_OUT];
+    out->frames_in  = sum[METRIC_FRAMES_IN];
+    out->frames_out = sum[METRIC_FRAMES_OUT];
+
+    for( int r = PKT_SUCCESS + 1; r < METRICS_PACKET_RESULTS; ++r )
+        out->parse_errors[r] = sum[METRIC_PARSE_ERROR + r];
+
+    out->recv_stalls    = sum[METRIC_RECV_STALLS];
+    out->send_drops     = sum[METRIC_SEND_DROPS];
+    out->partial_writes = sum[METRIC_PARTIAL_WRITES];
+    out->accepts        = sum[METRIC_ACCEPTS];
+    out->disconnects    = sum[METRIC_DISCONNECTS];
+}
@@ -0,0 +1,332 @@
+/**
+ * 파일명: src/MpmcQueue.c
+ *
+ * 개요:
+ * MpmcQueue.h 에 선언된 Lock-Free Bounded MPMC 큐 구현부.
+ *
+ * [알고리즘]
+ * 슬롯마다 순번(seq)을 두는 Ring Buffer 방식. (Dmitry Vyukov의 Bounded MPMC Queue)
+ * - 생산자: enqueue_pos 를 CAS로 선점 -> 슬롯에 데이터 기록 -> seq = pos + 1 로 공개
+ * - 소비자: dequeue_pos 를 CAS로 선점 -> 데이터 읽기 -> seq = pos + capacity 로 슬롯 반납
+ * 슬롯의 seq만 보고 비었는지/찼는지 판단하므로 생산자와 소비자가 서로의 위치 변수를 건드리지 않는다.
+ *
+ * [대기]
+ * 소비자는 큐가 비었을 때만 Mutex + Condition Variable 로 잠든다.
+ * 생산자는 잠든 소비자가 있을 때만 Mutex 를 잡고 깨운다. (평상시 Enqueue는 Lock 없음)
+ */
+
+#include "MpmcQueue.h"
+
+#include <stdio.h>   // NULL
+#include <stdlib.h>  // malloc, free
+#include <stdint.h>  // intptr_t
+#include <pthread.h> // pthread_mutex_*, pthread_cond_* (빈 큐 대기용)
+
+// --------------------------------------------------------------------------
+// 내부 구조체 정의
+// --------------------------------------------------------------------------
+
+#define MPMC_CACHE_LINE       64 // False Sharing 방지용 정렬 단위
+#define MPMC_SPIN_BEFORE_WAIT 64 // 잠들기 전 재시도 횟수 (짧은 공백에 시스템 콜 회피)
+
+typedef struct
+{
+    size_t seq;  // 슬롯 순번 (pos + 1: 데이터 있음, pos: 비어있음)
+    void*  data;
+} MpmcCell;
+
+struct MpmcQueue
+{
+    MpmcCell* cells;
+    size_t    mask; // capacity - 1
+
+    // 생산자/소비자 위치는 서로 다른 캐시 라인에 둔다.
+    char   pad0[MPMC_CACHE_LINE];
+    size_t enqueue_pos;
+    char   pad1[MPMC_CACHE_LINE - sizeof( size_t )];
+    size_t dequeue_pos;
+    char   pad2[MPMC_CACHE_LINE - sizeof( size_t )];
+
+    int             sleepers; // 빈 큐에서 대기 중인 소비자 수
+    pthread_mutex_t mutex;    // 대기 전용 (데이터 경로에서는 사용하지 않음)
+    pthread_cond_t  cond;     // 'Not Empty' 조건 변수
+};
+
+
+// --------------------------------------------------------------------------
+// 함수 구현
+// --------------------------------------------------------------------------
+
+MpmcQueue* MpmcQueue_Create( int capacity )
+{
+    if( capacity <= 0 ){
+        return NULL;
+    }
+
+    // 2의 거듭제곱으로 올림 (최소 2)
+    size_t size = 2;
+    while( size < (size_t)capacity ){
+        size <<= 1;
+    }
+
+    MpmcQueue* queue = (MpmcQueue*)malloc( sizeof( MpmcQueue ) );
+    if( !queue ){
+        return NULL;
+    }
+
+    queue->cells = (MpmcCell*)malloc( sizeof( MpmcCell ) * size );
+    if( !queue->cells ){
+        free( queue );
+        return NULL;
+    }
+
+    for( size_t i = 0; i < size; ++i )
+    {
+        queue->cells[i].seq  = i;
+        queue->cells[i].data = NULL;
+    }
+
+    queue->mask        = size - 1;
+    queue->enqueue_pos = 0;
+    queue->dequeue_pos = 0;
+    queue->sleepers    = 0;
+
+    if( pthread_mutex_init( &queue->mutex, NULL ) != 0 ){
+        free( queue->cells );
+        free( queue );
+        return NULL;
+    }
+
+    if( pthread_cond_init( &queue->cond, NULL ) != 0 ){
+        pthread_mutex_destroy( &queue->mutex );
+        free( queue->cells );
+        free( queue );
+        return NULL;
+    }
+
+    return queue;
+}
+
+void MpmcQueue_Destroy( MpmcQueue* queue, FreeNodeFunc free_func )
+{
+    if( !queue )
+        return;
+
+    // 남은 데이터 정리 (이 시점에는 다른 스레드가 큐를 사용하지 않음)
+    void* data;
+    while( ( data = MpmcQueue_TryDequeue( queue ) ) != NULL )
+    {
+        if( free_func ){
+            free_func( data );
+        }
+    }
+
+    pthread_mutex_destroy( &queue->mutex );
+    pthread_cond_destroy ( &queue->cond  );
+
+    free( queue->cells );
+    free( queue );
+}
+
+/**
+ * ## 슬롯 하나를 선점해 데이터를 공개한다. (대기자 깨우기는 호출자가 담당)
+ */
+static bool TryPush( MpmcQueue* queue, void* data )
+{
+    MpmcCell* cell;
+    size_t    pos = __atomic_load_n( &queue->enqueue_pos, __ATOMIC_RELAXED );
+
+    for( ;; )
+    {
+        cell = &queue->cells[pos & queue->mask];
+
+        size_t   seq = __atomic_load_n( &cell->seq, __ATOMIC_ACQUIRE );
+        intptr_t dif = (intptr_t)seq - (intptr_t)pos;
+
+        if( dif == 0 )
+        {
+            // 빈 슬롯: 위치 선점 시도 (실패 시 pos가 최신값으로 갱신됨)
+            if( __atomic_compare_exchange_n( &queue->enqueue_pos, &pos, pos + 1,
+                                             true, __ATOMIC_RELAXED, __ATOMIC_RELAXED ) )
+                break;
+        }
+        else if( dif < 0 )
+        {
+            return false; // 한 바퀴 전 데이터가 아직 소비되지 않음 -> 가득 참
+        }
+        else
+        {
+            pos = __atomic_load_n( &queue->enqueue_pos, __ATOMIC_RELAXED );
+        }
+    }
+
+    cell->data = data;
+    __atomic_store_n( &cell->seq, pos + 1, __ATOMIC_RELEASE );
+
+    return true;
+}
+
+/**
+ * ## 빈 큐에서 잠든 소비자가 있으면 깨운다. (데이터를 공개한 뒤 호출)
+ */
+static void WakeSleepers( MpmcQueue* queue, bool all )
+{
+    // 데이터 공개와 대기자 확인 사이의 순서 보장 (소비자의 sleepers 증가 -> 재확인과 짝)
+    __atomic_thread_fence( __ATOMIC_SEQ_CST );
+
+    if( __atomic_load_n( &queue->sleepers, __ATOMIC_RELAXED ) > 0 )
+    {
+        pthread_mutex_lock( &queue->mutex );
+        if( all ) pthread_cond_broadcast( &queue->cond );
+        else      pthread_cond_signal   ( &queue->cond );
+        pthread_mutex_unlock( &queue->mutex );
+    }
+}
+
+bool MpmcQueue_Enqueue( MpmcQueue* queue, void* data )
+{
+    if( !queue || !data )
+        return false;
+
+    if( !TryPush( queue, data ) )
+        return false;
+
+    WakeSleepers( queue, false );
+    return true;
+}
+
+int MpmcQueue_EnqueueBatch( MpmcQueue* queue, void** items, int count )
+{
+    if( !queue || !items )
+        return 0;
+
+    int pushed = 0;
+    while( pushed < count && items[pushed] && TryPush( queue, items[pushed] ) )
+        pushed++;
+
+    // 여러 개를 넣었다면 여러 소비자가 나눠 가질 수 있도록 모두 깨운다.
+    if( pushed > 0 )
+        WakeSleepers( queue, pushed > 1 );
+
+    return pushed;
+}
+
+void* MpmcQueue_TryDequeue( MpmcQueue* queue )
+{
+    if( !queue )
+        return NULL;
+
+    MpmcCell* cell;
+    size_t    pos = __atomic_load_n( &queue->dequeue_pos, __ATOMIC_RELAXED );
+
+    for( ;; )
+    {
+        cell = &queue->cells[pos & queue->mask];
+
+        size_t   seq = __atomic_load_n( &cell->seq, __ATOMIC_ACQUIRE );
+        intptr_t dif = (intptr_t)seq - (intptr_t)( pos + 1 );
+
+        if( dif == 0 )
+        {
+            if( __atomic_compare_exchange_n( &queue->dequeue_pos, &pos, pos + 1,
+                                             true, __ATOMIC_RELAXED, __ATOMIC_RELAXED ) )
+                break;
+        }
+        else if( dif < 0 )
+        {
+            return NULL; // 아직 공개된 데이터 없음 -> 비어있음
+        }
+        else
+        {
+            pos = __atomic_load_n( &queue->dequeue_pos, __ATOMIC_RELAXED );
+        }
+    }
+
+    void* data = cell->data;
+
+    // 다음 바퀴의 생산자에게 슬롯 반납
+    __atomic_store_n( &cell->seq, pos + queue->mask + 1, __ATOMIC_RELEASE );
+
+    return data;
+}
+
+void* MpmcQueue_Dequeue( MpmcQueue* queue )
+{
+    if( !queue ) return NULL;
+
+    // 1. Fast Path: Lock 없이 꺼내기 (잠깐 비어있는 경우를 위해 몇 번 재시도)
+    for( int i = 0; i < MPMC_SPIN_BEFORE_WAIT; ++i )
+    {
+        void* data = MpmcQueue_TryDequeue( queue );
+        if( data )
+            return data;
+    }
+
+    // 2. Slow Path: 대기자로 등록한 뒤 다시 확인하고, 그래도 비어있으면 잠든다.
+    void* data = NULL;
+
+    pthread_mutex_lock( &queue->mutex );
+    {
+        __atomic_fetch_add( &queue->sleepers, 1, __ATOMIC_SEQ_CST );
+
+        while( ( data = MpmcQueue_TryDequeue( queue ) ) == NULL ){
+            pthread_cond_wait( &queue->cond, &queue->mutex );
+        }
+
+        __atomic_fetch_sub( &queue->sleepers, 1, __ATOMIC_SEQ_CST );
+    }
+    pthread_mutex_unlock( &queue->mutex );
+
+    return data;
+}
+
+int MpmcQueue_DequeueBatch( MpmcQueue* queue, void** out, int max )
+{
+    if( !queue || !out || max <= 0 )
+        return 0;
+
+    // 첫 원소는 필요하면 대기하고, 나머지는 이미 들어와 있는 만큼만 꺼낸다.
+    out[0] = MpmcQueue_Dequeue( queue );
+    if( !out[0] )
+        return 0;
+
+    int count = 1;
+    while( count < max && ( out[count] = MpmcQueue_TryDequeue( queue ) ) != NULL )
+        count++;
+
+    return count;
+}
+
+bool MpmcQueue_IsEmpty( MpmcQueue* queue )
+{
+    if( !queue )
+        return true;
+
+    size_t head = __atomic_load_n( &queue->dequeue_pos, __ATOMIC_ACQUIRE );
+    size_t tail = __atomic_load_n( &queue->enqueue_pos, __ATOMIC_ACQUIRE );
+
+    return (intptr_t)( tail - head ) <= 0;
+}
+
+bool MpmcQueue_IsFull( MpmcQueue* queue )
+{
+    if( !queue )
+        return false;
+
+    size_t head = __atomic_load_n( &queue->dequeue_pos, __ATOMIC_ACQUIRE );
+    size_t tail = __atomic_load_n( &queue->enqueue_pos, __ATOMIC_ACQUIRE );
+
+    return (intptr_t)( tail - head ) >= (intptr_t)( queue->mask + 1 );
+}
+
+int MpmcQueue_Size( MpmcQueue* queue )
+{
+    if( !queue )
+        return 0;
+
+    size_t   head = __atomic_load_n( &queue->dequeue_pos, __ATOMIC_ACQUIRE );
+    size_t   tail = __atomic_load_n( &queue->enqueue_pos, __ATOMIC_ACQUIRE );
+    intptr_t size = (intptr_t)( tail - head );
+
+    return ( size > 0 ) ? (int)size : 0;
+}
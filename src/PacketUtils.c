@@ -10,20 +10,47 @@
 #include <stdio.h>     // printf (디버깅용), NULL 매크로
 #include <arpa/inet.h> // htonl, ntohl (네트워크 바이트 오더 변환)
 
+// 기본 XOR 키. 해당 값은 수정 가능, 혹은 외부에서 인자로 받아올 수 있음.
+#define DEFAULT_XOR_KEY 0x5A
+
 // --------------------------------------------------------------------------
 // 암호화 / 복호화 구현
 // --------------------------------------------------------------------------
 
 void Packet_DefaultXor( char* data, int len )
 {
-    // 해당 값은 수정 가능, 혹은 외부에서 인자로 받아올 수 있음.
-    const char key = 0x5A;
+    const char key = DEFAULT_XOR_KEY;
 
     for( int i = 0; i < len; ++i ){
         data[i] ^= key;
     }
 }
 
+/**
+ * ## 원본을 dst로 복사하면서 암호화하고, 암호화된 결과의 체크섬을 반환한다.
+ * 기본 XOR 전략은 복사/암호화/체크섬을 한 번의 순회로 처리하고,
+ * 그 외 전략은 복사 후 제자리 암호화를 수행한다.
+ */
+static uint8_t EncryptCopy( char* dst, const char* src, int len, EncryptFunc encrypt_func )
+{
+    if( encrypt_func == Packet_DefaultXor )
+    {
+        const char key = DEFAULT_XOR_KEY;
+        uint8_t    sum = 0;
+
+        for( int i = 0; i < len; ++i ){
+            dst[i] = src[i] ^ key;
+            sum   += (uint8_t)dst[i];
+        }
+        return sum;
+    }
+
+    memcpy( dst, src, len );
+    encrypt_func( dst, len );
+
+    return Packet_CalcChecksum( dst, len );
+}
+
 // --------------------------------------------------------------------------
 // 체크섬 구현
 // --------------------------------------------------------------------------
@@ -86,6 +113,78 @@ int Packet_Serialize( char* out_buffer, int max_buf_size,
     return total_len;
 }
 
+int Packet_BuildFrame( PacketFrame* frame,
+                       const char* target_code,
+                       const void* body_ptr, int body_len,
+                       EncryptFunc encrypt_func, char* enc_buf )
+{
+    if( !frame || body_len < 0 )
+        return -1;
+
+    if( !body_ptr )
+        body_len = 0;
+
+    int total_len = sizeof( PacketHeader ) + body_len + CHECKSUM_LEN;
+
+    // 수신 측은 DEFAULT_BUF_SIZE 보다 큰 패킷을 받지 않는다.
+    if( total_len > DEFAULT_BUF_SIZE )
+        return -1;
+
+    if( encrypt_func && body_len > 0 && !enc_buf )
+        return -1;
+
+    // 1. 헤더 구성
+    frame->header.total_len = htonl( total_len );
+
+    memset( frame->header.target, 0, TARGET_NAME_LEN );
+    if( target_code ){
+        strncpy( frame->header.target, target_code, TARGET_NAME_LEN );
+    }
+
+    // 2. 바디 (평문은 원본을 그대로, 암호화는 enc_buf 로 복사+암호화)
+    //    체크섬은 단순 합이므로 헤더와 바디를 나누어 계산한 뒤 더해도 같다.
+    uint8_t     checksum = Packet_CalcChecksum( (const char*)&frame->header, sizeof( PacketHeader ) );
+    const char* body_out = (const char*)body_ptr;
+
+    if( body_len > 0 )
+    {
+        if( encrypt_func )
+        {
+            checksum += EncryptCopy( enc_buf, (const char*)body_ptr, body_len, encrypt_func );
+            body_out  = enc_buf;
+        }
+        else
+        {
+            checksum += Packet_CalcChecksum( body_out, body_len );
+        }
+    }
+
+    frame->checksum  = checksum;
+    frame->total_len = total_len;
+
+    // 3. IO 벡터 구성
+    int n = 0;
+
+    frame->iov[n].iov_base = &frame->header;
+    frame->iov[n].iov_len  = sizeof( PacketHeader );
+    n++;
+
+    if( body_len > 0 )
+    {
+        frame->iov[n].iov_base = (void*)body_out;
+        frame->iov[n].iov_len  = body_len;
+        n++;
+    }
+
+    frame->iov[n].iov_base = &frame->checksum;
+    frame->iov[n].iov_len  = CHECKSUM_LEN;
+    n++;
+
+    frame->iov_count = n;
+
+    return total_len;
+}
+
 // --------------------------------------------------------------------------
 // 역직렬화 (Deserialize) 구현
 // --------------------------------------------------------------------------
@@ -3,9 +3,11 @@
  *
  * 개요:
  * SafeQueue.h 에 선언된 유한 버퍼 큐 구현부.
+ * SAFE_QUEUE_LOCKFREE 로 생성된 큐는 모든 연산을 MpmcQueue 에 위임한다.
  */
 
 #include "SafeQueue.h"
+#include "MpmcQueue.h" // SAFE_QUEUE_LOCKFREE 구현
 
 #include <stdio.h>   // printf, NULL
 #include <stdlib.h>  // malloc, free (노드 및 큐 구조체 동적 할당/해제)
@@ -23,22 +25,51 @@ typedef struct Node
 
 struct SafeQueue
 {
+    MpmcQueue* lockfree; // SAFE_QUEUE_LOCKFREE 인 경우에만 사용 (아래 필드는 미사용)
+
     Node* head; // Pop 위치
     Node* tail; // Push 위치
 
     int count;    // 현재 요소 개수
     int capacity; // 최대 허용 개수
 
+    int high_watermark; // (atomic) 지금까지 가장 많이 찼을 때의 요소 개수 (두 구현 공통)
+
     pthread_mutex_t mutex; // 동기화 객체
     pthread_cond_t  cond;  // 'Not Empty' 조건 변수 (소비자 대기용)
 };
 
 
+// --------------------------------------------------------------------------
+// 내부 함수
+// --------------------------------------------------------------------------
+
+/**
+ * ## 넣은 직후의 요소 개수로 최고 기록을 갱신한다. (Lock-Free 큐는 여러 생산자가 동시에 갱신할 수 있음)
+ */
+static inline void UpdateHighWatermark( SafeQueue* queue, int size )
+{
+    int high = __atomic_load_n( &queue->high_watermark, __ATOMIC_RELAXED );
+
+    while( size > high )
+    {
+        if( __atomic_compare_exchange_n( &queue->high_watermark, &high, size, true,
+                                         __ATOMIC_RELAXED, __ATOMIC_RELAXED ) )
+            break;
+    }
+}
+
+
 // --------------------------------------------------------------------------
 // 함수 구현
 // --------------------------------------------------------------------------
 
 SafeQueue* SafeQueue_Create( int capacity )
+{
+    return SafeQueue_CreateEx( capacity, SAFE_QUEUE_LOCKED );
+}
+
+SafeQueue* SafeQueue_CreateEx( int capacity, SafeQueueType type )
 {
     if( capacity <= 0 ){
         return NULL;
@@ -49,6 +80,19 @@ SafeQueue* SafeQueue_Create( int capacity )
         return NULL;
     }
 
+    queue->lockfree       = NULL;
+    queue->high_watermark = 0;
+
+    if( type == SAFE_QUEUE_LOCKFREE )
+    {
+        queue->lockfree = MpmcQueue_Create( capacity );
+        if( !queue->lockfree ){
+            free( queue );
+            return NULL;
+        }
+        return queue;
+    }
+
     queue->head     = NULL;
     queue->tail     = NULL;
     queue->count    = 0;
@@ -73,6 +117,12 @@ void SafeQueue_Destroy( SafeQueue* queue, FreeNodeFunc free_func )
     if( !queue )
         return;
 
+    if( queue->lockfree ){
+        MpmcQueue_Destroy( queue->lockfree, free_func );
+        free( queue );
+        return;
+    }
+
     pthread_mutex_lock( &queue->mutex );
 
     Node* current = queue->head;
@@ -104,6 +154,15 @@ bool SafeQueue_Enqueue( SafeQueue* queue, void* data )
     if( !queue || !data )
         return false;
 
+    if( queue->lockfree )
+    {
+        if( !MpmcQueue_Enqueue( queue->lockfree, data ) )
+            return false;
+
+        UpdateHighWatermark( queue, MpmcQueue_Size( queue->lockfree ) );
+        return true;
+    }
+
     bool result = false;
 
     pthread_mutex_lock( &queue->mutex );
@@ -143,6 +202,8 @@ bool SafeQueue_Enqueue( SafeQueue* queue, void* data )
                 queue->count++;
                 result = true;
 
+                UpdateHighWatermark( queue, queue->count );
+
                 // 대기 중인 소비자(Dequeue) 깨움
                 pthread_cond_signal( &queue->cond );
             }
@@ -153,10 +214,95 @@ bool SafeQueue_Enqueue( SafeQueue* queue, void* data )
     return result;
 }
 
+int SafeQueue_EnqueueBatch( SafeQueue* queue, void** items, int count )
+{
+    if( !queue || !items || count <= 0 )
+        return 0;
+
+    if( queue->lockfree )
+    {
+        int pushed = MpmcQueue_EnqueueBatch( queue->lockfree, items, count );
+        if( pushed > 0 )
+            UpdateHighWatermark( queue, MpmcQueue_Size( queue->lockfree ) );
+
+        return pushed;
+    }
+
+    // 노드는 Lock 밖에서 미리 연결해 두고, 임계 영역에서는 포인터만 이어 붙인다.
+    Node* first = NULL;
+    Node* last  = NULL;
+    int   built = 0;
+
+    while( built < count && items[built] )
+    {
+        Node* new_node = (Node*)malloc( sizeof( Node ) );
+        if( !new_node )
+            break;
+
+        new_node->data = items[built];
+        new_node->next = NULL;
+
+        if( last ) { last->next = new_node; }
+        else       { first      = new_node; }
+
+        last = new_node;
+        built++;
+    }
+
+    int pushed = 0;
+
+    pthread_mutex_lock( &queue->mutex );
+    {
+        // 용량이 허용하는 앞부분만 사용
+        int space = queue->capacity - queue->count;
+        pushed = ( built < space ) ? built : space;
+
+        if( pushed > 0 )
+        {
+            Node* tail = first;
+            for( int i = 1; i < pushed; ++i )
+                tail = tail->next;
+
+            last       = tail->next; // 들어가지 못한 나머지 (해제 대상)
+            tail->next = NULL;
+
+            if( queue->tail == NULL ) { queue->head       = first; }
+            else                      { queue->tail->next = first; }
+
+            queue->tail   = tail;
+            queue->count += pushed;
+
+            UpdateHighWatermark( queue, queue->count );
+
+            // 여러 개를 넣었다면 여러 소비자가 나눠 가질 수 있도록 모두 깨운다.
+            if( pushed > 1 ) pthread_cond_broadcast( &queue->cond );
+            else             pthread_cond_signal   ( &queue->cond );
+        }
+        else
+        {
+            last = first;
+        }
+    }
+    pthread_mutex_unlock( &queue->mutex );
+
+    // 들어가지 못한 노드 해제 (데이터 소유권은 호출자에게 남음)
+    while( last )
+    {
+        Node* next = last->next;
+        free( last );
+        last = next;
+    }
+
+    return pushed;
+}
+
 void* SafeQueue_Dequeue( SafeQueue* queue )
 {
     if( !queue ) return NULL;
 
+    if( queue->lockfree )
+        return MpmcQueue_Dequeue( queue->lockfree );
+
     void* data = NULL;
 
     pthread_mutex_lock( &queue->mutex );
@@ -183,11 +329,64 @@ void* SafeQueue_Dequeue( SafeQueue* queue )
     return data;
 }
 
+int SafeQueue_DequeueBatch( SafeQueue* queue, void** out, int max )
+{
+    if( !queue || !out || max <= 0 )
+        return 0;
+
+    if( queue->lockfree )
+        return MpmcQueue_DequeueBatch( queue->lockfree, out, max );
+
+    int   count = 0;
+    Node* taken = NULL; // 꺼낸 노드 목록 (해제는 Lock 밖에서)
+
+    pthread_mutex_lock( &queue->mutex );
+    {
+        // 데이터가 없으면 대기 (Blocking)
+        while( queue->count == 0 ){
+            pthread_cond_wait( &queue->cond, &queue->mutex );
+        }
+
+        taken = queue->head;
+
+        Node* curr = queue->head;
+        Node* prev = NULL;
+
+        while( curr && count < max )
+        {
+            out[count++] = curr->data;
+            prev = curr;
+            curr = curr->next;
+        }
+
+        prev->next  = NULL;
+        queue->head = curr;
+        if( queue->head == NULL ){
+            queue->tail = NULL;
+        }
+
+        queue->count -= count;
+    }
+    pthread_mutex_unlock( &queue->mutex );
+
+    while( taken )
+    {
+        Node* next = taken->next;
+        free( taken );
+        taken = next;
+    }
+
+    return count;
+}
+
 bool SafeQueue_IsEmpty( SafeQueue* queue )
 {
     if( !queue )
         return true;
 
+    if( queue->lockfree )
+        return MpmcQueue_IsEmpty( queue->lockfree );
+
     bool is_empty = false;
     pthread_mutex_lock( &queue->mutex );
     {
@@ -203,6 +402,9 @@ bool SafeQueue_IsFull( SafeQueue* queue )
     if( !queue )
         return false;
 
+    if( queue->lockfree )
+        return MpmcQueue_IsFull( queue->lockfree );
+
     bool is_full = false;
     pthread_mutex_lock( &queue->mutex );
     {
@@ -211,4 +413,30 @@ bool SafeQueue_IsFull( SafeQueue* queue )
     pthread_mutex_unlock( &queue->mutex );
 
     return is_full;
-}
\ No newline at end of file
+}
+
+int SafeQueue_Size( SafeQueue* queue )
+{
+    if( !queue )
+        return 0;
+
+    if( queue->lockfree )
+        return MpmcQueue_Size( queue->lockfree );
+
+    int size = 0;
+    pthread_mutex_lock( &queue->mutex );
+    {
+        size = queue->count;
+    }
+    pthread_mutex_unlock( &queue->mutex );
+
+    return size;
+}
+
+int SafeQueue_HighWatermark( SafeQueue* queue )
+{
+    if( !queue )
+        return 0;
+
+    return __atomic_load_n( &queue->high_watermark, __ATOMIC_RELAXED );
+}
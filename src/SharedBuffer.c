@@ -0,0 +1,49 @@
+/**
+ * 파일명: src/SharedBuffer.c
+ *
+ * 개요:
+ * SharedBuffer.h 에 선언된 참조 카운트 버퍼 구현부.
+ */
+
+#include "SharedBuffer.h"
+
+#include <stdio.h>  // NULL
+#include <stdlib.h> // malloc, free
+
+// --------------------------------------------------------------------------
+// 함수 구현
+// --------------------------------------------------------------------------
+
+SharedBuffer* SharedBuffer_Create( int capacity )
+{
+    if( capacity <= 0 ){
+        return NULL;
+    }
+
+    SharedBuffer* buf = (SharedBuffer*)malloc( sizeof( SharedBuffer ) + capacity );
+    if( !buf ){
+        return NULL;
+    }
+
+    buf->refcount = 1;
+    buf->capacity = capacity;
+    buf->len      = 0;
+
+    return buf;
+}
+
+void SharedBuffer_Retain( SharedBuffer* buf )
+{
+    if( buf )
+        __atomic_fetch_add( &buf->refcount, 1, __ATOMIC_RELAXED );
+}
+
+void SharedBuffer_Release( SharedBuffer* buf )
+{
+    if( !buf )
+        return;
+
+    // 마지막 참조를 놓은 스레드만 해제한다. (다른 스레드의 읽기가 해제보다 먼저 끝나도록 ACQ_REL)
+    if( __atomic_sub_fetch( &buf->refcount, 1, __ATOMIC_ACQ_REL ) == 0 )
+        free( buf );
+}
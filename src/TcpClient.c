@@ -12,13 +12,14 @@
 #include <string.h>      // strncpy, memset, strncmp (문자열 및 메모리 조작)
 #include <arpa/inet.h>   // inet_pton, htons, ntohl (주소 변환 및 바이트 오더링)
 #include <sys/socket.h>  // socket, connect, recv, send, sockaddr 구조체
+#include <sys/time.h>    // struct timeval (SO_RCVTIMEO)
 #include <errno.h>       // errno (에러 코드 확인)
 
 // --------------------------------------------------------------------------
 // 1. 내부 헬퍼 함수 (Low-Level IO)
 // --------------------------------------------------------------------------
 
-static int RecvExact( int fd, char* buf, int len )
+static int RecvExact( Metrics* metrics, int fd, char* buf, int len )
 {
     int total_read = 0;
     while( total_read < len )
@@ -27,9 +28,69 @@ static int RecvExact( int fd, char* buf, int len )
         if( received <= 0 ) return received; // 0: Close, -1: Error
         total_read += received;
     }
+    Metrics_Add( metrics, METRIC_BYTES_IN, (uint64_t)total_read );
     return total_read;
 }
 
+/**
+ * ## 프레임의 IO 벡터를 끝까지 전송한다. (Blocking 소켓, 부분 전송 시 이어서 전송)
+ * Return: 전송한 총 바이트 수 (-1: 에러)
+ */
+static int SendFrameAll( Metrics* metrics, int fd, PacketFrame* frame )
+{
+    struct iovec* iov       = frame->iov;
+    int           iov_count = frame->iov_count;
+    int           total     = 0;
+
+    while( iov_count > 0 )
+    {
+        struct msghdr msg;
+        memset( &msg, 0, sizeof( msg ) );
+        msg.msg_iov    = iov;
+        msg.msg_iovlen = iov_count;
+
+        // MSG_NOSIGNAL: 상대방 연결 끊김 시 SIGPIPE 시그널 발생 방지 (writev 에는 플래그가 없음)
+        ssize_t sent = sendmsg( fd, &msg, MSG_NOSIGNAL );
+        if( sent < 0 )
+        {
+            if( errno == EINTR ) continue;
+            return -1;
+        }
+        total += (int)sent;
+        Metrics_Add( metrics, METRIC_BYTES_OUT, (uint64_t)sent );
+
+        // 전송된 만큼 벡터를 전진
+        while( iov_count > 0 && (size_t)sent >= iov->iov_len )
+        {
+            sent -= iov->iov_len;
+            iov++;
+            iov_count--;
+        }
+        if( iov_count > 0 )
+        {
+            iov->iov_base  = (char*)iov->iov_base + sent;
+            iov->iov_len  -= sent;
+
+            Metrics_Add( metrics, METRIC_PARTIAL_WRITES, 1 ); // 남은 벡터를 이어서 전송
+        }
+    }
+    Metrics_Add( metrics, METRIC_FRAMES_OUT, 1 );
+    return total;
+}
+
+/**
+ * ## 소켓의 수신 타임아웃을 설정한다. (0 이하: 무기한 대기)
+ * 타임아웃이 지나면 recv 가 EAGAIN 으로 실패하여 수신 루프가 연결을 재설정한다.
+ */
+static void ApplyRecvTimeout( int fd, int timeout_ms )
+{
+    struct timeval tv;
+    tv.tv_sec  = ( timeout_ms > 0 ) ? timeout_ms / 1000 : 0;
+    tv.tv_usec = ( timeout_ms > 0 ) ? ( timeout_ms % 1000 ) * 1000 : 0;
+
+    setsockopt( fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof( tv ) );
+}
+
 // --------------------------------------------------------------------------
 // 2. 연결 상태 관리 함수 (Connection Management)
 // --------------------------------------------------------------------------
@@ -49,6 +110,8 @@ static void ResetConnection( TcpClientContext* ctx )
         // printf( "[TcpClient] Resetting connection (FD: %d)...\n", ctx->sockfd );
         close( ctx->sockfd );
         ctx->sockfd = -1;
+
+        Metrics_Add( ctx->metrics, METRIC_DISCONNECTS, 1 );
     }
 
     // 재연결 시 평문 핸드셰이크를 위해 전략 초기화
@@ -100,7 +163,7 @@ static bool TryHandshake( TcpClientContext* ctx, int sock, char* buffer )
     const int header_size = sizeof( PacketHeader );
 
     // 1. 헤더 수신
-    if( RecvExact( sock, buffer, header_size ) <= 0 )
+    if( RecvExact( ctx->metrics, sock, buffer, header_size ) <= 0 )
         return false;
 
     PacketHeader* header    = (PacketHeader*)buffer;
@@ -114,7 +177,7 @@ static bool TryHandshake( TcpClientContext* ctx, int sock, char* buffer )
     int body_len = total_len - header_size;
     if( body_len > 0 )
     {
-        if( RecvExact( sock, buffer + header_size, body_len ) <= 0 )
+        if( RecvExact( ctx->metrics, sock, buffer + header_size, body_len ) <= 0 )
             return false;
     }
 
@@ -126,8 +189,13 @@ static bool TryHandshake( TcpClientContext* ctx, int sock, char* buffer )
     PacketResult result
         = Packet_Parse( buffer, total_len, NULL, target_buf, &body_ptr, &parsed_body_len );
 
+    Metrics_Add( ctx->metrics, METRIC_FRAMES_IN, 1 );
+
     if( result != PKT_SUCCESS )
+    {
+        Metrics_AddParseError( ctx->metrics, result );
         return false;
+    }
 
     // 5. 검증 및 설정
     if( strncmp( target_buf, TARGET_SEC_STRATEGY, TARGET_NAME_LEN ) != 0 )
@@ -142,6 +210,21 @@ static bool TryHandshake( TcpClientContext* ctx, int sock, char* buffer )
     // 전략 적용
     ctx->SetStrategy( ctx, Packet_GetEncryptFunc( code ), Packet_GetDecryptFunc( code ) );
 
+    // 6. 적용 완료 응답 (협상된 전략으로 암호화, 서버는 이를 받고 연결을 ESTABLISHED 로 전환)
+    PacketFrame ack;
+    char        enc_buf[sizeof( SecurityStrategyBody )];
+
+    if( Packet_BuildFrame( &ack, TARGET_SEC_ACK, strategy_pkt, sizeof( SecurityStrategyBody ),
+                           ctx->encrypt_fn, enc_buf ) <= 0 )
+        return false;
+
+    pthread_mutex_lock( &ctx->send_mutex );
+    int ack_sent = SendFrameAll( ctx->metrics, sock, &ack );
+    pthread_mutex_unlock( &ctx->send_mutex );
+
+    if( ack_sent < 0 )
+        return false;
+
     printf( "[TcpClient] Handshake Success. Strategy: %d\n", code );
     return true;
 }
@@ -187,6 +270,9 @@ static void* NetworkManagerThread( void* arg )
                 continue;
             }
 
+            // 응답 없는 서버에 핸드셰이크 도중 멈추지 않도록 유휴 타임아웃을 먼저 적용
+            ApplyRecvTimeout( sock, ctx->idle_timeout_ms );
+
             // 2. 애플리케이션 핸드셰이크
 
             // 성공: 소켓 등록 (State -> Connected)
@@ -195,6 +281,8 @@ static void* NetworkManagerThread( void* arg )
                 pthread_mutex_lock( &ctx->conn_mutex );
                 ctx->sockfd = sock;
                 pthread_mutex_unlock( &ctx->conn_mutex );
+
+                Metrics_Add( ctx->metrics, METRIC_ACCEPTS, 1 );
             }
             // 실패: 즉시 정리 후 재시도
             else
@@ -210,7 +298,7 @@ static void* NetworkManagerThread( void* arg )
         // ---------------------------------------------------------
 
         // A. 헤더 읽기
-        if( RecvExact( curr_fd, recv_buf, header_size ) <= 0 )
+        if( RecvExact( ctx->metrics, curr_fd, recv_buf, header_size ) <= 0 )
         {
             ResetConnection( ctx ); // 에러 발생 시 초기화
             continue;
@@ -223,6 +311,7 @@ static void* NetworkManagerThread( void* arg )
         if( total_len > DEFAULT_BUF_SIZE || total_len < header_size )
         {
             printf( "[TcpClient] Invalid Packet Len: %u\n", total_len );
+            Metrics_AddParseError( ctx->metrics, PKT_ERR_LENGTH_MISMATCH );
             ResetConnection( ctx );
             continue;
         }
@@ -231,7 +320,7 @@ static void* NetworkManagerThread( void* arg )
         int body_len = total_len - header_size;
         if( body_len > 0 )
         {
-            if( RecvExact( curr_fd, recv_buf + header_size, body_len ) <= 0 )
+            if( RecvExact( ctx->metrics, curr_fd, recv_buf + header_size, body_len ) <= 0 )
             {
                 ResetConnection( ctx );
                 continue;
@@ -243,9 +332,18 @@ static void* NetworkManagerThread( void* arg )
         char* body_ptr   = NULL;
         int   parsed_len = 0;
 
-        if( Packet_Parse( recv_buf, total_len, ctx->decrypt_fn, target_buf, &body_ptr, &parsed_len ) == PKT_SUCCESS )
+        PacketResult result = Packet_Parse( recv_buf, total_len, ctx->decrypt_fn, target_buf, &body_ptr, &parsed_len );
+
+        Metrics_Add( ctx->metrics, METRIC_FRAMES_IN, 1 );
+
+        if( result == PKT_SUCCESS )
         {
-            if( ctx->on_message )
+            // 서버의 생존 확인: 바로 응답하고 콜백에는 전달하지 않는다.
+            if( strncmp( target_buf, TARGET_HEARTBEAT_PING, TARGET_NAME_LEN ) == 0 )
+            {
+                ctx->Send( ctx, TARGET_HEARTBEAT_PONG, NULL, 0 );
+            }
+            else if( ctx->on_message )
             {
                 ctx->on_message( ctx, ctx->service_ctx, target_buf, body_ptr, parsed_len );
             }
@@ -254,6 +352,7 @@ static void* NetworkManagerThread( void* arg )
         {
              // 파싱 실패(체크섬 등)는 연결을 끊을 수도 있고, 로그만 남길 수도 있음.
              // 여기선 안전을 위해 재연결
+             Metrics_AddParseError( ctx->metrics, result );
              ResetConnection( ctx );
         }
 
@@ -340,17 +439,27 @@ static int impl_Send( TcpClientContext* ctx, const char* target, void* body, int
     pthread_mutex_unlock( &ctx->conn_mutex );
 
     if( fd == -1 )
+    {
+        Metrics_Add( ctx->metrics, METRIC_SEND_DROPS, 1 );
         return -1; // 연결 안됨
+    }
 
-    char* send_buf = (char*)malloc( DEFAULT_BUF_SIZE );
-    int   pkt_len  = Packet_Serialize( send_buf, DEFAULT_BUF_SIZE, target, body, len, ctx->encrypt_fn );
+    // 헤더와 체크섬만 만들고 바디는 writev 로 그대로 전송 (암호화 시에만 스택 버퍼로 복사+암호화)
+    char        enc_buf[DEFAULT_BUF_SIZE];
+    PacketFrame frame;
+
+    int pkt_len = Packet_BuildFrame( &frame, target, body, len, ctx->encrypt_fn, enc_buf );
 
     int sent = -1;
     if( pkt_len > 0 ){
-        sent = send( fd, send_buf, pkt_len, MSG_NOSIGNAL );
+        // Blocking 소켓은 버퍼가 차면 프레임 도중에 다른 스레드의 쓰기가 끼어들 수 있으므로 프레임 단위로 직렬화
+        pthread_mutex_lock( &ctx->send_mutex );
+        sent = SendFrameAll( ctx->metrics, fd, &frame );
+        pthread_mutex_unlock( &ctx->send_mutex );
     }
 
-    free( send_buf );
+    if( sent < 0 )
+        Metrics_Add( ctx->metrics, METRIC_SEND_DROPS, 1 );
 
     return sent;
 }
@@ -366,6 +475,27 @@ static void impl_SetStrategy( TcpClientContext* ctx, EncryptFunc enc, DecryptFun
     }
 }
 
+static void impl_SetIdleTimeout( TcpClientContext* ctx, int timeout_ms )
+{
+    if( !ctx )
+        return;
+
+    pthread_mutex_lock( &ctx->conn_mutex );
+    {
+        ctx->idle_timeout_ms = ( timeout_ms > 0 ) ? timeout_ms : 0;
+
+        // 이미 연결되어 있으면 바로 적용 (재연결 시에는 핸드셰이크 후 적용됨)
+        if( ctx->sockfd != -1 )
+            ApplyRecvTimeout( ctx->sockfd, ctx->idle_timeout_ms );
+    }
+    pthread_mutex_unlock( &ctx->conn_mutex );
+}
+
+static void impl_GetStats( TcpClientContext* ctx, TcpStats* out )
+{
+    Metrics_GetStats( ctx ? ctx->metrics : NULL, out );
+}
+
 static void impl_Destroy( TcpClientContext* ctx )
 {
     if( !ctx ) return;
@@ -375,6 +505,8 @@ static void impl_Destroy( TcpClientContext* ctx )
     }
 
     pthread_mutex_destroy( &ctx->conn_mutex );
+    pthread_mutex_destroy( &ctx->send_mutex );
+    Metrics_Destroy( ctx->metrics );
     free( ctx );
 
     // printf( "[TcpClient] Context destroyed.\n" );
@@ -394,6 +526,12 @@ TcpClientContext* CreateTcpClientContext( OnMessageCallback callback, void* serv
 
     memset( ctx, 0, sizeof( TcpClientContext ) );
 
+    ctx->metrics = Metrics_Create();
+    if( ctx->metrics == NULL ){
+        free( ctx );
+        return NULL;
+    }
+
     ctx->sockfd      = -1;
     ctx->is_running  = false;
     ctx->on_message  = callback;
@@ -401,6 +539,7 @@ TcpClientContext* CreateTcpClientContext( OnMessageCallback callback, void* serv
 
     // 뮤텍스 초기화
     pthread_mutex_init( &ctx->conn_mutex, NULL );
+    pthread_mutex_init( &ctx->send_mutex, NULL );
 
     ctx->encrypt_fn = Packet_DefaultXor;
     ctx->decrypt_fn = Packet_DefaultXor;
@@ -412,5 +551,8 @@ TcpClientContext* CreateTcpClientContext( OnMessageCallback callback, void* serv
     ctx->SetStrategy = impl_SetStrategy;
     ctx->Destroy     = impl_Destroy;
 
+    ctx->SetIdleTimeout = impl_SetIdleTimeout;
+    ctx->GetStats       = impl_GetStats;
+
     return ctx;
 }
\ No newline at end of file
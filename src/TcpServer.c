@@ -3,90 +3,428 @@
  * 개요: TcpServer.h 에 선언된 서버 컨텍스트의 핵심 구현부
  *
  * [아키텍처]
- * 1. Main Thread (Epoll): 연결 수락(Accept) -> Handshake -> 리스트 추가 -> 데이터 수신(Recv) -> RecvQueue Push
+ * 1. Reactor Threads (Epoll): 연결 수락(Accept) -> 리스트 추가 -> Handshake -> 데이터 수신(Recv) -> RecvQueue Push
+ *    - 핸드셰이크는 Init 에서 한 번 직렬화한 프레임을 송신 대기열로 Non-blocking 전송하고,
+ *      클라이언트의 SEC_ACK (또는 첫 프레임)를 받으면 연결이 ESTABLISHED 가 된다.
+ *    - Reactor마다 자신의 Epoll 인스턴스와 SO_REUSEPORT 리스너를 가지며, 커널이 연결을 분산한다.
+ *    - Reactor 0 은 Run 을 호출한 스레드에서 동작한다.
  * 2. Worker Threads: RecvQueue Pop -> 패킷 파싱 -> 비즈니스 로직(Callback) -> (필요시) SendQueue Push
- * 3. Sender Thread: SendQueue Pop -> 패킷 직렬화 -> 암호화 -> 실제 전송(Send/Broadcast)
+ *    - 워커마다 자신의 RecvQueue를 가지며, 연결은 FD 해시로 하나의 워커에 고정된다. (연결 내 순서 보장)
+ * 3. Sender Thread: SendQueue Pop -> 헤더/체크섬 생성 -> (복사+암호화) -> sendmsg 전송(Send/Broadcast)
+ *    - 소켓이 가득 차면 남은 바이트를 연결별 송신 대기열(참조 카운트 세그먼트)에 보관하고 EPOLLOUT을 등록한다.
+ *    - 소켓이 다시 쓰기 가능해지면 Reactor가 대기열을 비운다. (송신 스레드는 절대 블로킹되지 않음)
+ *    - Broadcast는 프레임을 한 번만 직렬화/암호화한 SharedBuffer를 모든 연결이 공유한다.
+ *    - Send 는 그 연결 앞으로 SendQueue 에 밀린 요청이 없으면 호출 스레드에서 바로 쓴다. (송신 스레드 생략)
+ *
+ * [Run-to-Completion] (TcpServerConfig.dispatch_mode = SERVER_DISPATCH_INLINE)
+ * - 워커/송신 스레드 없이 Reactor가 프레임을 잘라 그 자리에서 파싱 -> 콜백을 실행한다.
+ * - Send/Broadcast 는 큐를 거치지 않고 호출한 스레드에서 바로 WriteFrame 한다. (쓰기 불가 시 대기열 + EPOLLOUT)
+ *
+ * [클라이언트 레지스트리]
+ * - FD로 인덱싱된 테이블. 각 칸은 그 FD를 수락한 Reactor만 쓰므로 등록/제거에 Lock이 없다.
+ * - Sender 등 다른 스레드는 Epoch 읽기 구간 안에서 Lock 없이 테이블을 읽는다.
+ *   제거된 노드는 진행 중인 읽기 구간이 모두 끝난 뒤에 해제된다. (Epoch.h)
+ *
+ * [IO 백엔드] (TcpServerConfig.io_backend)
+ * - SERVER_IO_EPOLL : 위 설명대로 epoll_wait + 연산마다 recv/send 시스템 콜
+ * - SERVER_IO_URING : Reactor가 io_uring 으로 accept / recv(Provided Buffer Ring) / send 를 일괄 제출한다.
+ *                     Sender는 소켓에 바로 쓰지 못한 나머지만 송신 큐에 쌓고 eventfd 로 Reactor를 깨운다.
+ *
+ * [Reactor 깨우기]
+ * - Reactor마다 eventfd(wake_fd)를 대기 집합에 등록해 두고, 할 일이 없으면 타임아웃 없이 대기한다.
+ * - Stop/Destroy, 워커의 읽기 재개(low 워터마크), io_uring 송신 요청이 eventfd 에 써서 루프를 즉시 깨운다.
+ *
+ * [유휴 타임아웃 / Heartbeat] (TcpServerConfig.idle_timeout_ms, heartbeat_interval_ms)
+ * - Reactor마다 계층형 타이머 휠(TimerWheel.h)을 두고, 연결마다 타이머 하나를 등록한다. (등록/취소 O(1))
+ * - 수신 시에는 마지막 수신 시각만 기록하고, 타이머가 만료되면 그때 실제 유휴 시간을 확인해
+ *   HB_PING 전송, 연결 종료, 또는 다음 확인 시각으로 재등록 중 하나를 한다. (수신마다 휠을 건드리지 않음)
+ * - 이벤트 대기 타임아웃은 가장 가까운 타이머까지로 줄어들며, 타이머가 없으면 여전히 무기한 대기한다.
+ *
+ * [사용자 타이머] (ScheduleTimer / SchedulePeriodic)
+ * - 별도 타이머 휠을 Reactor 0 이 루프마다 돌린다. (timer_mutex 보호, 등록 시 Reactor 0 을 깨워 대기 시간을 다시 계산)
+ * - 만료된 타이머는 수신 태스크로 감싸 워커 0 의 RecvQueue 에 넣으므로, 콜백은 메시지 처리와 같은 스레드에서
+ *   순서대로 실행된다. (타이머 전용 스레드 없음, INLINE 모드는 Reactor 0 이 직접 실행)
  */
 
+#define _GNU_SOURCE // accept4 (모든 헤더보다 먼저 정의해야 함)
+
 #include "TcpServer.h"
-#include "PacketUtils.h" // 패킷 파싱 및 직렬화 함수 사용
+#include "PacketUtils.h"  // 패킷 파싱 및 직렬화 함수 사용
+#include "SharedBuffer.h" // 송신 대기 세그먼트 (참조 카운트 버퍼)
+#include "Epoch.h"        // 클라이언트 노드 지연 해제
+#include "TimerWheel.h"   // 연결별 유휴 타이머
 
 #include <stdio.h>       // printf, perror (로그 및 에러 출력)
 #include <stdlib.h>      // malloc, free (태스크 및 컨텍스트 할당)
 #include <string.h>      // memset, memcpy, strncpy
-#include <unistd.h>      // close, fcntl (파일 디스크립터 제어)
-#include <fcntl.h>       // F_SETFL, O_NONBLOCK (Non-blocking 설정 매크로)
+#include <unistd.h>      // close, read, write
+#include <fcntl.h>       // fcntl, F_DUPFD_CLOEXEC (공유 리스너 복제)
 #include <errno.h>       // errno, EINTR
+#include <signal.h>      // sigset_t, sigaddset (서버 스레드의 종료 시그널 차단)
+#include <time.h>        // clock_gettime (타이머 휠 시각)
 #include <arpa/inet.h>   // htons, INADDR_ANY (네트워크 주소 관련)
-#include <sys/socket.h>  // socket, bind, listen, accept, send, recv, setsockopt
+#include <sys/socket.h>  // socket, bind, listen, accept4, send, recv, setsockopt
 #include <sys/epoll.h>   // epoll_create1, epoll_ctl, epoll_wait
+#include <sys/resource.h>// getrlimit (FD 인덱스 테이블 크기 결정)
+#include <sys/eventfd.h> // eventfd (Reactor 깨우기)
+#include <sys/mman.h>    // mmap, munmap (io_uring 링 매핑)
+#include <sys/syscall.h> // syscall, __NR_io_uring_* (liburing 없이 직접 호출)
+
+// io_uring 백엔드는 Provided Buffer Ring / Multishot Recv 를 지원하는 커널 헤더(6.0+)가 있을 때만 빌드된다.
+// 헤더가 없거나 런타임에 io_uring 생성이 실패하면 epoll 백엔드로 자동 대체된다.
+#if defined( __has_include )
+#if __has_include( <linux/io_uring.h> )
+#include <linux/io_uring.h>
+#endif
+#endif
+
+#if defined( IORING_RECV_MULTISHOT ) && defined( __NR_io_uring_setup )
+#define TCPC_HAVE_IO_URING 1
+#else
+#define TCPC_HAVE_IO_URING 0
+#endif
 
 
 // --------------------------------------------------------------------------
-// 1. 내부 구조체 정의 (ClientNode 은닉)
+// 1. 내부 구조체 정의 (ClientNode, ServerReactor, ServerWorker 은닉)
 // --------------------------------------------------------------------------
 
+/**
+ * 워커 스레드 하나의 상태. 자신의 RecvQueue만 소비한다.
+ */
+typedef struct ServerWorker
+{
+    TcpServerContext* ctx;
+    int               index;
+
+    pthread_t  thread;
+    bool       thread_started;
+    SafeQueue* recv_queue; // Reactor -> 이 워커 (ServerRecvTask*)
+
+    // 수신 Backpressure (큐가 high 워터마크에 닿으면 Reactor가 켜고, low 이하가 되면 워커/Reactor가 끈다)
+    bool     read_paused;  // (atomic) 이 워커로 가는 연결의 소켓 읽기 중단 여부
+    uint64_t pause_count;  // (atomic) 중단 누적 횟수
+    uint64_t resume_count; // (atomic) 재개 누적 횟수
+} ServerWorker;
+
+/**
+ * IO 루프 하나의 상태. 자신이 수락한 연결만 자신의 Epoll에서 처리한다.
+ */
+typedef struct ServerReactor
+{
+    TcpServerContext* ctx;
+    int               index;
+
+    int listen_fd; // SO_REUSEPORT 리스너 (Reactor마다 별도)
+    int epoll_fd;
+    struct epoll_event* events; // Epoll 이벤트 버퍼
+
+    pthread_t     thread;         // Reactor 0 은 사용하지 않음 (Run 호출 스레드)
+    bool          thread_started;
+    volatile bool is_running;
+
+    // 읽기 예산을 소진해 다음 루프에서 이어 읽어야 할 FD 목록
+    int* read_pending_fds;
+    int* read_pending_swap;  // 처리 중 재등록을 위한 교대 버퍼
+    int  read_pending_count;
+
+    // Backpressure로 읽기를 멈춘 연결 목록 (워커 큐가 줄어들면 이어 읽는다)
+    struct ClientNode* paused_head;
+
+    int wake_fd; // eventfd: 종료 요청, 읽기 재개, (io_uring) 송신 요청 시 대기 중인 루프를 깨운다.
+
+    TimerWheel* timers; // 이 Reactor 소유 연결들의 유휴 타이머
+    uint64_t    now_ms; // 루프가 깨어날 때마다 갱신하는 단조 시각 (수신 시각 기록용)
+
+    struct ServerTimer* fired_timers; // (Reactor 0) 이번 루프에서 만료된 사용자 타이머 (timer_mutex 보호)
+
+    // --- io_uring 백엔드 전용 ---
+    struct UringQueue* uring;
+
+    uint64_t wake_value; // eventfd READ 결과 저장소
+
+    pthread_mutex_t flush_mutex;    // flush_fds 보호 (Sender가 등록, Reactor가 소비)
+    int*            flush_fds;      // 송신 큐를 비워달라고 요청한 FD 목록
+    int*            flush_swap;     // Reactor 처리용 교대 버퍼
+    int             flush_count;
+    int             flush_capacity;
+} ServerReactor;
+
+/**
+ * 연결별 송신 대기열의 원소. 프레임(또는 그 나머지)을 참조 카운트 버퍼로 가리킨다.
+ * Broadcast 프레임은 모든 연결이 같은 버퍼를 참조하므로 느린 클라이언트가 있어도 복사하지 않는다.
+ */
+typedef struct OutSegment
+{
+    SharedBuffer*      buf;
+    int                offset; // 이미 보낸 바이트 수
+    struct OutSegment* next;
+} OutSegment;
+
+// 연결 상태 (소유 Reactor만 바꾼다)
+typedef enum
+{
+    CONN_AWAIT_HANDSHAKE_ACK = 0, // 핸드셰이크를 대기열에 넣고 클라이언트의 첫 프레임(SEC_ACK)을 기다리는 중
+    CONN_ESTABLISHED              // 클라이언트가 전략을 적용함 (이후 프레임은 모두 콜백으로 전달)
+} ConnState;
+
 typedef struct ClientNode
 {
-    int fd;
-    struct ClientNode* next;
+    int        fd;
+    ConnHandle handle; // (세대 << 32) | fd. 같은 FD를 재사용한 새 연결과 구분한다.
+    ConnState  state;
+
+    ServerReactor* reactor; // 이 연결을 소유한 Reactor
+
+    // 유휴 타임아웃/Heartbeat (Reactor 전용, Lock 불필요)
+    TimerEntry idle_timer;   // 다음 확인 시각에 만료되는 타이머 (reactor->timers)
+    uint64_t   last_recv_ms; // 마지막으로 데이터를 받은 시각 (reactor->now_ms)
+
+    // 스트림 재조립용 수신 버퍼 (Reactor 전용, Lock 불필요)
+    // TCP는 패킷 경계를 보장하지 않으므로, 완성되지 않은 프레임은 다음 이벤트까지 보관한다.
+    char* recv_buf; // DEFAULT_BUF_SIZE 크기 (최대 패킷 크기와 동일)
+    int   recv_len; // 현재 버퍼에 쌓인 바이트 수
+
+    // 읽기 예산을 다 써서 커널 버퍼에 데이터가 남아있을 수 있는 상태 (Pending 리스트 중복 방지)
+    bool read_pending;
+
+    // 워커 큐가 가득 차 읽기를 멈춘 상태 (Reactor의 paused 목록에 연결됨)
+    // recv_buf 에는 아직 워커에 전달하지 못한 완성 프레임이 남아있을 수 있다.
+    bool               read_paused;
+    struct ClientNode* paused_prev;
+    struct ClientNode* paused_next;
+
+    // 송신 대기열 (Sender가 채우고 Reactor가 EPOLLOUT 시 비움, out_mutex로 보호)
+    // 커널 송신 버퍼가 가득 찼을 때만 쌓인다. (느린 클라이언트에게만 메모리 사용)
+    pthread_mutex_t out_mutex;
+    OutSegment*     out_head;  // 다음에 보낼 세그먼트
+    OutSegment*     out_tail;  // 마지막 세그먼트 (덧붙이기 위치)
+    int             out_len;   // 보내지 못하고 남은 바이트 수 (config.outbound_buffer_size 이하)
+    bool            out_armed; // EPOLLOUT 등록 여부 (io_uring: 송신 요청 또는 전송 진행 중)
+    bool            closed;    // 소켓이 닫혔거나 닫히는 중 (이후 쓰기 금지, out_mutex로 보호)
+
+    // SendQueue 에 들어가 아직 송신 스레드가 쓰지 않은 이 연결 앞 요청 수 (atomic)
+    // 0이 아니면 Send 는 순서를 지키기 위해 직접 쓰지 않고 큐 뒤에 붙인다.
+    int send_queued;
+
+    // 송신 묶음 (out_mutex로 보호). 모인 프레임은 대기열에 있으며 아래 조건이 풀릴 때 한 번에 보낸다.
+    int  cork_depth;    // Cork 중첩 수 (0보다 크면 Uncork 때까지 보내지 않고 모음)
+    bool in_send_batch; // 송신 스레드의 현재 배치에 등록됨 (배치 끝에 전송)
+
+    // io_uring 백엔드 전용 (Reactor 전용, Lock 불필요)
+    int  uring_inflight;      // 이 연결을 참조하는 제출된 요청 수 (0이 되어야 노드 해제 가능)
+    bool uring_send_inflight; // SEND 요청 진행 중 (out_head 세그먼트를 커널이 읽는 중, out_mutex로 보호)
+    bool closing;             // 종료 진행 중 (남은 요청 완료 대기)
+    bool uring_recv_armed;    // Multishot Recv 가 걸려있음 (읽기 중단 시 취소하고 재개 시 다시 건다)
+    bool uring_eof;           // 읽기 중단 중 상대방이 연결을 닫음 (보류 데이터를 모두 전달한 뒤 종료)
+    char* hold_buf;           // 읽기 중단 중 도착한 수신 데이터 (순서대로 보관, 재개 시 이어 처리)
+    int   hold_len;
+    int   hold_cap;
 } ClientNode;
 
+/**
+ * ScheduleTimer/SchedulePeriodic 으로 등록된 타이머. 필드는 ctx->timer_mutex 로 보호한다.
+ * 워커에 실행을 맡긴 동안(busy)에는 취소되어도 해제하지 않고, 실행을 마친 워커가 해제한다.
+ */
+typedef struct ServerTimer
+{
+    TimerEntry    entry; // ctx->timer_wheel 에 등록되는 항목
+    ServerTimerId id;
+
+    OnServerTimerCallback callback;
+    void*                 arg;
+
+    int      interval_ms; // 0: 일회성
+    uint64_t due_ms;      // 다음 만료 시각 (주기 타이머는 이전 만료 시각 + interval_ms)
+    bool     busy;        // 워커에 실행을 맡김 (큐에 있거나 콜백 실행 중)
+    bool     cancelled;
+
+    struct TcpServerContext* ctx;
+    struct ServerTimer*      prev; // ctx->timer_list
+    struct ServerTimer*      next;
+    struct ServerTimer*      fired_next; // 이번 Advance 에서 만료된 목록
+} ServerTimer;
+
+// ReadClient 결과
+typedef enum
+{
+    READ_DRAINED = 0, // EAGAIN까지 모두 읽음 (다음 Edge 이벤트 대기)
+    READ_BUDGET,      // 예산 소진, 데이터가 남아있을 수 있음 (다음 루프에서 이어 읽기)
+    READ_PAUSED,      // 워커 큐가 가득 차 읽기 중단 (큐가 줄어들면 이어 읽기)
+    READ_CLOSED       // 연결 종료 또는 프로토콜 오류
+} ReadResult;
+
+// DispatchFrames 결과
+typedef enum
+{
+    DISPATCH_OK = 0,  // 완성된 프레임을 모두 워커에 전달함
+    DISPATCH_STALLED, // 워커 큐가 가득 차 일부 프레임이 수신 버퍼에 남음 (읽기 중단 필요)
+    DISPATCH_ERROR    // 프레임 길이가 잘못되어 스트림 동기화 불가 (연결 종료 필요)
+} DispatchResult;
+
 
 // --------------------------------------------------------------------------
 // 2. 클라이언트 리스트 관리 함수 (Context 내부 멤버 사용)
 // --------------------------------------------------------------------------
 
 /**
- * ## 연결된 클라이언트 FD를 리스트에 추가한다. (Thread-Safe)
+ * ##   FD로 노드를 찾는다. (Lock-Free)
+ * #### 다른 스레드의 노드를 읽을 때는 Epoch 읽기 구간(ctx->client_epoch) 안에서 호출하고,
+ * #### 구간을 나온 뒤에는 반환된 노드를 사용하면 안 된다. (소유 Reactor는 구간 없이 사용 가능)
+ */
+static inline ClientNode* LookupClient( TcpServerContext* ctx, int fd )
+{
+    if( fd < 0 || fd >= ctx->client_table_size )
+        return NULL;
+
+    return __atomic_load_n( &ctx->client_table[fd], __ATOMIC_ACQUIRE );
+}
+
+/**
+ * ##   핸들로 노드를 찾는다. (Lock-Free, LookupClient 와 같은 읽기 구간 규칙)
+ * #### 슬롯의 현재 연결이 핸들을 발급받은 연결이 아니면(끊긴 뒤 FD 재사용) NULL을 반환한다.
+ */
+static inline ClientNode* LookupConn( TcpServerContext* ctx, ConnHandle handle )
+{
+    ClientNode* node = LookupClient( ctx, CONN_HANDLE_SLOT( handle ) );
+    return ( node && node->handle == handle ) ? node : NULL;
+}
+
+static bool QueueSegment( ClientNode* node, SharedBuffer* buf, int offset );
+static void ScheduleIdleTimer( ServerReactor* reactor, ClientNode* node );
+static void OnIdleTimer( void* arg );
+
+/**
+ * ##   연결된 클라이언트 FD를 테이블에 등록한다. (소유 Reactor 전용, Lock-Free)
+ * #### 핸드셰이크 프레임을 공개 전에 송신 대기열 맨 앞에 넣어 두므로, 다른 스레드의 송신이 앞지르지 못한다.
+ * #### 실제 전송은 IO 등록을 마친 뒤 StartHandshake 가 한다.
+ * Return: 생성된 노드 (실패 시 NULL)
  */
-static void AddClient( TcpServerContext* ctx, int fd )
+static ClientNode* AddClient( TcpServerContext* ctx, ServerReactor* reactor, int fd )
 {
+    if( fd < 0 || fd >= ctx->client_table_size )
+        return NULL;
+
     ClientNode* node = (ClientNode*)malloc( sizeof( ClientNode ) );
 
     if( !node )
-        return;
-
-    node->fd   = fd;
-    node->next = NULL;
+        return NULL;
 
-    pthread_mutex_lock( &ctx->client_list_mutex );
+    // 슬롯의 세대를 올려 새 핸들을 발급한다. (0은 CONN_HANDLE_INVALID 와 겹치므로 건너뜀)
+    uint32_t generation = __atomic_load_n( &ctx->client_generations[fd], __ATOMIC_RELAXED ) + 1;
+    if( generation == 0 )
+        generation = 1;
+    __atomic_store_n( &ctx->client_generations[fd], generation, __ATOMIC_RELAXED );
+
+    node->fd       = fd;
+    node->handle   = ( (ConnHandle)generation << 32 ) | (uint32_t)fd;
+    node->state    = CONN_AWAIT_HANDSHAKE_ACK;
+    node->reactor  = reactor;
+    node->recv_len = 0;
+
+    TimerEntry_Init( &node->idle_timer, OnIdleTimer, node );
+    node->last_recv_ms = reactor->now_ms;
+    node->recv_buf = (char*)malloc( DEFAULT_BUF_SIZE );
+
+    node->read_pending = false;
+    node->read_paused  = false;
+    node->paused_prev  = NULL;
+    node->paused_next  = NULL;
+
+    node->out_head  = NULL;
+    node->out_tail  = NULL;
+    node->out_len   = 0;
+    node->out_armed = false;
+    node->closed    = false;
+    pthread_mutex_init( &node->out_mutex, NULL );
+
+    node->send_queued   = 0;
+    node->cork_depth    = 0;
+    node->in_send_batch = false;
+
+    node->uring_inflight      = 0;
+    node->uring_send_inflight = false;
+    node->closing             = false;
+    node->uring_recv_armed    = false;
+    node->uring_eof           = false;
+    node->hold_buf            = NULL;
+    node->hold_len            = 0;
+    node->hold_cap            = 0;
+
+    if( !node->recv_buf || !QueueSegment( node, ctx->handshake_frame, 0 ) )
     {
-        node->next = ctx->client_list_head;
+        pthread_mutex_destroy( &node->out_mutex );
+        free( node->recv_buf );
+        free( node );
+        return NULL;
+    }
 
-        ctx->client_list_head = node;
-        ctx->current_client_count++;
+    // 노드 초기화가 끝난 뒤 공개한다. (RELEASE: 읽는 쪽이 초기화 전 값을 보지 않도록)
+    __atomic_store_n( &ctx->client_table[fd], node, __ATOMIC_RELEASE );
+    __atomic_add_fetch( &ctx->current_client_count, 1, __ATOMIC_RELAXED );
+    Metrics_Add( ctx->metrics, METRIC_ACCEPTS, 1 );
+    Metrics_Add( ctx->metrics, METRIC_FRAMES_OUT, 1 ); // 대기열에 넣은 핸드셰이크
+
+    // 순회 범위 갱신 (FD는 작은 번호부터 재사용되므로 테이블 앞쪽만 훑으면 된다)
+    int high = __atomic_load_n( &ctx->client_high_fd, __ATOMIC_RELAXED );
+    while( fd >= high
+           && !__atomic_compare_exchange_n( &ctx->client_high_fd, &high, fd + 1, false,
+                                            __ATOMIC_RELEASE, __ATOMIC_RELAXED ) )
+    {
     }
-    pthread_mutex_unlock( &ctx->client_list_mutex );
+
+    ScheduleIdleTimer( reactor, node );
+    return node;
 }
 
 /**
- * ## 연결 해제된 클라이언트 FD를 리스트에서 제거한다. (Thread-Safe)
+ * ## 송신 대기열을 모두 버린다. (out_mutex 보유 또는 노드를 혼자 사용하는 상태)
  */
-static void RemoveClient( TcpServerContext* ctx, int fd )
+static void DropOutbound( ClientNode* node )
 {
-    pthread_mutex_lock( &ctx->client_list_mutex );
+    OutSegment* seg = node->out_head;
+    while( seg )
     {
-        ClientNode* curr = ctx->client_list_head;
-        ClientNode* prev = NULL;
+        OutSegment* next = seg->next;
+        SharedBuffer_Release( seg->buf );
+        free( seg );
+        seg = next;
+    }
 
-        while( curr != NULL )
-        {
-            if( curr->fd == fd )
-            {
-                if( prev == NULL ) { ctx->client_list_head = curr->next; }
-                else               { prev->next = curr->next; }
+    node->out_head = NULL;
+    node->out_tail = NULL;
+    node->out_len  = 0;
+}
+
+/**
+ * ## 노드와 노드가 소유한 버퍼를 해제한다. (테이블에서 제거되고 읽기 구간이 모두 끝난 이후 호출)
+ */
+static void FreeClientNode( void* data )
+{
+    ClientNode* node = (ClientNode*)data;
 
-                free( curr );
-                ctx->current_client_count--;
+    DropOutbound( node );
+    pthread_mutex_destroy( &node->out_mutex );
+    free( node->recv_buf );
+    free( node->hold_buf );
+    free( node );
+}
 
-                break;
-            }
-            prev = curr;
-            curr = curr->next;
-        }
-    }
-    pthread_mutex_unlock( &ctx->client_list_mutex );
+/**
+ * ## 연결 해제된 클라이언트 FD를 테이블에서 제거한다. (소유 Reactor 전용, Lock-Free)
+ * 다른 스레드가 읽기 구간 안에서 아직 노드를 보고 있을 수 있으므로 해제는 Epoch에 맡긴다.
+ */
+static void RemoveClient( TcpServerContext* ctx, int fd )
+{
+    ClientNode* node = LookupClient( ctx, fd );
+    if( !node )
+        return;
+
+    __atomic_store_n( &ctx->client_table[fd], NULL, __ATOMIC_RELEASE );
+    __atomic_sub_fetch( &ctx->current_client_count, 1, __ATOMIC_RELAXED );
+    Metrics_Add( ctx->metrics, METRIC_DISCONNECTS, 1 );
+
+    Epoch_Retire( ctx->client_epoch, node, FreeClientNode );
 }
 
 
@@ -94,389 +432,2897 @@ static void RemoveClient( TcpServerContext* ctx, int fd )
 // 3. 헬퍼 함수
 // --------------------------------------------------------------------------
 
-static void SetNonBlocking( int fd )
+/**
+ * ## 연결이 고정된 워커 (연결마다 항상 같은 워커로 보내 패킷 순서를 보장한다)
+ */
+static inline ServerWorker* WorkerOf( TcpServerContext* ctx, ClientNode* node )
 {
-    int flags = fcntl( fd, F_GETFL, 0 );
-    fcntl( fd, F_SETFL, flags | O_NONBLOCK );
+    return &ctx->workers[node->fd % ctx->worker_count];
 }
 
+/**
+ * ## 단조 증가 시각 (밀리초, 타이머 휠 기준 시계)
+ */
+static inline uint64_t MonotonicMs( void )
+{
+    struct timespec ts;
+    clock_gettime( CLOCK_MONOTONIC, &ts );
+    return (uint64_t)ts.tv_sec * 1000u + (uint64_t)ts.tv_nsec / 1000000u;
+}
 
-// --------------------------------------------------------------------------
-// 4. 큐 데이터 해제 콜백 (SafeQueue_Destroy용)
-// --------------------------------------------------------------------------
+/**
+ * ##   Reactor의 eventfd 에 써서 대기 중인 루프를 즉시 깨운다. (어느 스레드에서나 호출 가능)
+ * #### write 한 번뿐이므로 시그널 핸들러에서 호출해도 안전하다.
+ */
+static void WakeReactor( ServerReactor* reactor )
+{
+    if( reactor->wake_fd < 0 )
+        return;
 
-static void FreeRecvTask( void* data )
+    uint64_t one = 1;
+    ssize_t  ret = write( reactor->wake_fd, &one, sizeof( one ) );
+    (void)ret; // EAGAIN(카운터 포화)이어도 이미 깨어날 예정
+}
+
+static void WakeAllReactors( TcpServerContext* ctx )
 {
-    ServerRecvTask* task = (ServerRecvTask*)data;
-    if( task )
-    {
-        if( task->data )
-            free( task->data );
-        free( task );
-    }
+    for( int i = 0; ctx->reactors && i < ctx->reactor_count; ++i )
+        WakeReactor( &ctx->reactors[i] );
 }
 
-static void FreeSendTask( void* data )
+/**
+ * ## 연결의 읽기를 멈추고 Reactor의 paused 목록에 등록한다. (Reactor 전용)
+ * Return: 새로 멈췄으면 true (이미 멈춘 상태면 false)
+ */
+static bool PauseReads( TcpServerContext* ctx, ClientNode* node )
 {
-    ServerSendTask* task = (ServerSendTask*)data;
-    if( task )
-    {
-        if( task->body_data )
-            free( task->body_data );
-        free( task );
-    }
+    if( node->read_paused )
+        return false;
+
+    ServerReactor* reactor = node->reactor;
+
+    node->read_paused  = true;
+    node->read_pending = false; // 재개 시 처음부터 다시 읽으므로 이어 읽기 목록은 무시
+    node->paused_prev  = NULL;
+    node->paused_next  = reactor->paused_head;
+
+    if( reactor->paused_head )
+        reactor->paused_head->paused_prev = node;
+    reactor->paused_head = node;
+
+    __atomic_add_fetch( &ctx->paused_connections, 1, __ATOMIC_RELAXED );
+    return true;
 }
 
+/**
+ * ## 연결을 paused 목록에서 뺀다. (Reactor 전용, 재개 또는 종료 시)
+ */
+static void UnpauseReads( TcpServerContext* ctx, ClientNode* node )
+{
+    if( !node->read_paused )
+        return;
+
+    ServerReactor* reactor = node->reactor;
 
-// --------------------------------------------------------------------------
-// 5. 워커 스레드 (Worker Thread)
-//    수신된 Raw 데이터를 파싱하고 사용자 콜백을 호출한다.
-// --------------------------------------------------------------------------
+    if( node->paused_prev ) node->paused_prev->paused_next = node->paused_next;
+    else                    reactor->paused_head         = node->paused_next;
 
-static void* WorkerThreadFunc( void* arg )
+    if( node->paused_next ) node->paused_next->paused_prev = node->paused_prev;
+
+    node->read_paused = false;
+    node->paused_prev = NULL;
+    node->paused_next = NULL;
+
+    __atomic_sub_fetch( &ctx->paused_connections, 1, __ATOMIC_RELAXED );
+}
+
+/**
+ * ##   보안 전략 핸드셰이크 프레임을 만든다. (평문, XOR 통보)
+ * #### 내용이 연결마다 같으므로 Init 에서 한 번만 직렬화하고, 모든 연결의 송신 대기열이 참조로 공유한다.
+ * Return: 참조 수 1의 프레임 (실패 시 NULL)
+ */
+static SharedBuffer* CreateHandshakeFrame( void )
 {
-    TcpServerContext* ctx = (TcpServerContext*)arg;
+    SecurityStrategyBody strat_body;
+    strat_body.strategy_code = SEC_STRATEGY_XOR;
 
-    while( ctx->is_running )
-    {
-        // 1. 큐에서 작업 가져오기 (Blocking)
-        ServerRecvTask* task = (ServerRecvTask*)SafeQueue_Dequeue( ctx->recv_queue );
+    int           capacity = sizeof( PacketHeader ) + sizeof( SecurityStrategyBody ) + CHECKSUM_LEN;
+    SharedBuffer* frame    = SharedBuffer_Create( capacity );
+    if( !frame )
+        return NULL;
 
-        // 2. 종료 신호(Poison Pill) 확인
-        // task가 NULL이거나, fd가 -1인 경우 종료로 간주
-        if( !task || task->client_fd == -1 )
-        {
-            if( task )
-                FreeRecvTask( task );
+    // 암호화 함수 인자에 NULL 전달 -> 평문 헤더+바디 생성
+    frame->len = Packet_Serialize( frame->data, capacity, TARGET_SEC_STRATEGY,
+                                   &strat_body, sizeof( SecurityStrategyBody ), NULL /* 평문 */ );
 
-            break;
-        }
+    if( frame->len <= 0 )
+    {
+        SharedBuffer_Release( frame );
+        return NULL;
+    }
 
-        // 3. 패킷 파싱
-        char  target_buf[TARGET_NAME_LEN];
-        char* body_ptr = NULL;
-        int   body_len = 0;
+    return frame;
+}
 
-        // In-place decryption을 위해 task->data(힙 메모리)를 바로 넘김
-        PacketResult result
-            = Packet_Parse( task->data, task->len, ctx->decrypt_fn,
-                            target_buf, &body_ptr, &body_len );
+/**
+ * ##   Heartbeat(HB_PING) 프레임을 만든다.
+ * #### 바디가 없어 암호화 전략과 무관하므로 핸드셰이크처럼 Init 에서 한 번만 만들어 공유한다.
+ * Return: 참조 수 1의 프레임 (실패 시 NULL)
+ */
+static SharedBuffer* CreateHeartbeatFrame( void )
+{
+    int           capacity = sizeof( PacketHeader ) + CHECKSUM_LEN;
+    SharedBuffer* frame    = SharedBuffer_Create( capacity );
+    if( !frame )
+        return NULL;
 
-        if( result == PKT_SUCCESS )
-        {
-            // 4. 사용자 콜백 호출 (비즈니스 로직)
-            if( ctx->on_message )
-            {
-                ctx->on_message(
-                    ctx, task->client_fd, ctx->service_ctx,
-                    target_buf, body_ptr, body_len
-                );
-            }
-        }
-        else
-        {
-            // 파싱 실패 시 로그 (운영 환경에선 파일 로그 권장)
-            // printf( "[Worker] Parse failed (FD: %d, Err: %d)\n", task->client_fd, result );
-        }
+    frame->len = Packet_Serialize( frame->data, capacity, TARGET_HEARTBEAT_PING, NULL, 0, NULL );
 
-        // 5. 작업 메모리 해제
-        FreeRecvTask( task );
+    if( frame->len <= 0 )
+    {
+        SharedBuffer_Release( frame );
+        return NULL;
     }
 
-    return NULL;
+    return frame;
+}
+
+/**
+ * ## 클라이언트 연결을 종료한다. (Reactor 전용)
+ * 송신 스레드가 닫힌(또는 재사용된) FD에 쓰지 않도록 closed 를 먼저 표시하고,
+ * 리스트에서 제거한 뒤 소켓을 닫아 재사용된 FD가 잘못 제거되는 일을 막는다.
+ */
+static void CloseClient( TcpServerContext* ctx, ClientNode* node )
+{
+    int fd = node->fd;
+
+    pthread_mutex_lock( &node->out_mutex );
+    node->closed = true;
+    DropOutbound( node );
+    pthread_mutex_unlock( &node->out_mutex );
+
+    UnpauseReads( ctx, node );
+    TimerWheel_Cancel( node->reactor->timers, &node->idle_timer );
+
+    RemoveClient( ctx, fd ); // node 해제는 다른 스레드의 읽기 구간이 끝난 뒤 일어남
+    close( fd );             // Epoll에서 자동 제거됨
+
+    // printf( "[TcpServer] Client %d disconnected.\n", fd );
 }
 
 
 // --------------------------------------------------------------------------
-// 6. 송신 스레드 (Sender Thread)
-// 설명: 전송 요청을 직렬화하여 소켓에 쓴다. (Broadcast 지원)
+// 4. 큐 데이터 해제 콜백 (SafeQueue_Destroy용)
 // --------------------------------------------------------------------------
 
-static void* SenderThreadFunc( void* arg )
+/**
+ * ## 수신 태스크를 풀에서 빌린다. data 는 같은 블록 안의 DEFAULT_BUF_SIZE 버퍼를 가리킨다.
+ */
+static ServerRecvTask* AllocRecvTask( TcpServerContext* ctx )
 {
-    TcpServerContext* ctx = (TcpServerContext*)arg;
+    ServerRecvTask* task = (ServerRecvTask*)BufferPool_Alloc( ctx->recv_pool );
+    if( task )
+    {
+        task->conn  = CONN_HANDLE_INVALID;
+        task->data  = (char*)( task + 1 );
+        task->len   = 0;
+        task->timer = NULL;
+    }
+    return task;
+}
+
+static void FreeRecvTask( void* data )
+{
+    // 태스크와 수신 버퍼는 한 블록이므로 한 번에 반납된다.
+    BufferPool_Free( data );
+}
+
+/**
+ * ## 바디 없이 송신 태스크를 풀에서 빌린다. (바디는 호출자가 연결)
+ */
+static ServerSendTask* AllocSendTaskHeader( TcpServerContext* ctx, ConnHandle conn, bool is_broadcast,
+                                            const char* target )
+{
+    ServerSendTask* task = (ServerSendTask*)BufferPool_Alloc( ctx->send_pool );
 
-    // 직렬화용 임시 버퍼 (스레드 로컬)
-    char* send_buf = (char*)malloc( DEFAULT_BUF_SIZE );
-    if( !send_buf )
+    if( !task )
         return NULL;
 
-    while( ctx->is_running )
-    {
-        // 1. 큐에서 전송 요청 가져오기
-        ServerSendTask* task = (ServerSendTask*)SafeQueue_Dequeue( ctx->send_queue );
+    task->conn         = conn;
+    task->is_broadcast = is_broadcast;
+    task->body_data    = NULL;
+    task->body_len     = 0;
+    task->body_release = NULL;
+    task->body_ref     = NULL;
 
-        // 2. 종료 신호 확인 (-2: Sender 종료 코드)
-        if( !task || task->client_fd == -2 )
-        {
-            if( task )
-                FreeSendTask( task );
-            break;
-        }
+    memset( task->target, 0, TARGET_NAME_LEN );
+    if( target ) strncpy( task->target, target, TARGET_NAME_LEN );
 
-        // 3. 패킷 직렬화 (암호화 포함)
-        int packet_len
-            = Packet_Serialize( send_buf, DEFAULT_BUF_SIZE, task->target,
-                                task->body_data, task->body_len, ctx->encrypt_fn );
+    return task;
+}
 
-        if( packet_len > 0 )
+/**
+ * ## 송신 태스크를 풀에서 빌리고 바디를 복사한다.
+ * SEND_INLINE_BODY_SIZE 이하의 바디는 태스크 안에 담기므로 할당은 풀 블록 하나뿐이다.
+ */
+static ServerSendTask* AllocSendTask( TcpServerContext* ctx, ConnHandle conn, bool is_broadcast,
+                                      const char* target, const void* body, int len )
+{
+    ServerSendTask* task = AllocSendTaskHeader( ctx, conn, is_broadcast, target );
+
+    if( !task )
+        return NULL;
+
+    // 바디 데이터 Deep Copy (비동기 전송을 위해 필수)
+    if( body && len > 0 )
+    {
+        if( len <= SEND_INLINE_BODY_SIZE )
         {
-            if( task->is_broadcast )
-            {
-                // 4-A. 브로드캐스트 전송
-                // 리스트 순회 시 Mutex 잠금 필수
-                pthread_mutex_lock( &ctx->client_list_mutex );
-                {
-                    ClientNode* curr = ctx->client_list_head;
-                    while( curr != NULL )
-                    {
-                        // MSG_NOSIGNAL: 상대방 연결 끊김 시 SIGPIPE 시그널 발생 방지
-                        send( curr->fd, send_buf, packet_len, MSG_NOSIGNAL );
-                        curr = curr->next;
-                    }
-                }
-                pthread_mutex_unlock( &ctx->client_list_mutex );
-            }
-            else
+            task->body_data = task->inline_body;
+        }
+        else
+        {
+            // 큰 바디만 힙으로 분리
+            task->body_data = (char*)malloc( len );
+            if( !task->body_data )
             {
-                // 4-B. 유니캐스트 전송
-                send( task->client_fd, send_buf, packet_len, MSG_NOSIGNAL );
+                BufferPool_Free( task );
+                return NULL;
             }
         }
 
-        // 작업 완료 후 해제
-        FreeSendTask( task );
+        memcpy( task->body_data, body, len );
+        task->body_len = len;
     }
 
-    free( send_buf );
-    return NULL;
+    return task;
+}
+
+static void FreeSendTask( void* data )
+{
+    ServerSendTask* task = (ServerSendTask*)data;
+    if( task )
+    {
+        if( task->body_ref )
+            SharedBuffer_Release( task->body_ref );
+        else if( task->body_release && task->body_data )
+            task->body_release( task->body_data );
+        else if( task->body_data != task->inline_body )
+            free( task->body_data );
+
+        BufferPool_Free( task );
+    }
 }
 
 
 // --------------------------------------------------------------------------
-// 7. 멤버 함수 구현
+// 5. 수신 스트림 재조립 (Reactor)
+//    누적된 수신 버퍼를 PacketHeader.total_len 기준으로 잘라 완성된 패킷만 RecvQueue에 넣는다.
 // --------------------------------------------------------------------------
 
-static bool impl_Server_Init( TcpServerContext* ctx, int port )
+/**
+ * ## 워커 큐가 high 워터마크에 닿았으면 그 워커로 가는 읽기를 멈춘다. (여러 Reactor가 동시에 넘겨도 한 번만 센다)
+ */
+static void CheckHighWatermark( TcpServerContext* ctx, ServerWorker* worker, bool force )
 {
-    if( !ctx )
-        return false;
+    if( __atomic_load_n( &worker->read_paused, __ATOMIC_ACQUIRE ) )
+        return;
 
-    // Epoll 생성
-    ctx->epoll_fd = epoll_create1( 0 );
-    if( ctx->epoll_fd < 0 )
-        return false;
+    if( !force && SafeQueue_Size( worker->recv_queue ) < ctx->config.recv_high_watermark )
+        return;
 
-    // Listen 소켓 생성
-    ctx->listen_fd = socket( AF_INET, SOCK_STREAM, 0 );
-    if( ctx->listen_fd < 0 )
-        return false;
+    bool expected = false;
+    if( __atomic_compare_exchange_n( &worker->read_paused, &expected, true, false,
+                                     __ATOMIC_ACQ_REL, __ATOMIC_RELAXED ) )
+        __atomic_add_fetch( &worker->pause_count, 1, __ATOMIC_RELAXED );
+}
 
-    // 주소 재사용 옵션 (서버 재시작 시 Bind Error 방지)
-    int opt = 1;
-    setsockopt( ctx->listen_fd, SOL_SOCKET, SO_REUSEADDR, &opt, sizeof( opt ) );
+/**
+ * ## 워커 큐가 low 워터마크 이하로 줄었으면 읽기를 재개시킨다. (워커, Reactor 어느 쪽에서나 호출)
+ */
+static void CheckLowWatermark( TcpServerContext* ctx, ServerWorker* worker )
+{
+    if( !__atomic_load_n( &worker->read_paused, __ATOMIC_ACQUIRE ) )
+        return;
 
-    // 바인딩
-    struct sockaddr_in addr;
-    memset( &addr, 0, sizeof( addr ) );
+    if( SafeQueue_Size( worker->recv_queue ) > ctx->config.recv_low_watermark )
+        return;
+
+    bool expected = true;
+    if( __atomic_compare_exchange_n( &worker->read_paused, &expected, false, false,
+                                     __ATOMIC_ACQ_REL, __ATOMIC_RELAXED ) )
+    {
+        __atomic_add_fetch( &worker->resume_count, 1, __ATOMIC_RELAXED );
+
+        // 멈춘 연결은 여러 Reactor에 흩어져 있으므로 모두 깨워 ResumePausedReads 를 돌게 한다.
+        WakeAllReactors( ctx );
+    }
+}
+
+/**
+ * ## 모아둔 수신 태스크를 한 번의 Lock으로 워커 큐에 넣는다.
+ * 큐가 가득 차 들어가지 못한 태스크는 해제한다. (그 프레임은 호출자가 수신 버퍼에 남겨 재개 후 다시 보냄)
+ *
+ * Return: 워커에 전달된 태스크 수
+ */
+static int FlushRecvTasks( TcpServerContext* ctx, ServerWorker* worker, ServerRecvTask** tasks, int count )
+{
+    int pushed = SafeQueue_EnqueueBatch( worker->recv_queue, (void**)tasks, count );
+
+    for( int i = pushed; i < count; ++i )
+        FreeRecvTask( tasks[i] ); // task와 data 모두 해제됨
+
+    if( pushed < count )
+        Metrics_Add( ctx->metrics, METRIC_RECV_STALLS, (uint64_t)( count - pushed ) );
+
+    CheckHighWatermark( ctx, worker, pushed < count );
+    return pushed;
+}
+
+/**
+ * ## 완성된 프레임 하나를 파싱해 사용자 콜백을 호출한다. (워커, 또는 INLINE 모드의 Reactor)
+ * data 는 In-place 로 복호화된다.
+ */
+static void HandleMessage( TcpServerContext* ctx, ConnHandle conn, char* data, int len )
+{
+    char  target_buf[TARGET_NAME_LEN];
+    char* body_ptr = NULL;
+    int   body_len = 0;
+
+    // 라이브러리가 소비하는 제어 프레임(SEC_ACK, HB_PONG)은 DispatchFrames 에서 센다.
+    Metrics_Add( ctx->metrics, METRIC_FRAMES_IN, 1 );
+
+    PacketResult result
+        = Packet_Parse( data, len, ctx->decrypt_fn,
+                        target_buf, &body_ptr, &body_len );
+
+    if( result == PKT_SUCCESS )
+    {
+        // 사용자 콜백 호출 (비즈니스 로직)
+        if( ctx->on_message )
+        {
+            ctx->on_message(
+                ctx, conn, ctx->service_ctx,
+                target_buf, body_ptr, body_len
+            );
+        }
+    }
+    else
+    {
+        // 파싱 실패는 결과 코드별로 센다. (GetStats)
+        Metrics_AddParseError( ctx->metrics, result );
+    }
+}
+
+/**
+ * ## 노드의 수신 버퍼에서 완성된 프레임을 모두 꺼내 워커로 전달한다.
+ * 남은 불완전 프레임은 버퍼 앞쪽으로 당겨 다음 수신 때 이어 붙인다.
+ * 워커 큐가 가득 차 전달하지 못한 프레임도 버리지 않고 버퍼에 남긴다. (DISPATCH_STALLED)
+ * INLINE 모드에서는 워커 대신 이 자리에서 콜백을 실행한다.
+ */
+static DispatchResult DispatchFrames( TcpServerContext* ctx, ClientNode* node )
+{
+    const int min_len = sizeof( PacketHeader ) + CHECKSUM_LEN;
+    int offset = 0;
+
+    ServerWorker*   worker = WorkerOf( ctx, node );
+    ServerRecvTask* batch[QUEUE_BATCH_SIZE];
+    int             batch_offset[QUEUE_BATCH_SIZE]; // 각 태스크 프레임의 수신 버퍼 내 시작 위치
+    int             batch_count = 0;
+    DispatchResult  result      = DISPATCH_OK;
+
+    while( result == DISPATCH_OK && node->recv_len - offset >= (int)sizeof( PacketHeader ) )
+    {
+        PacketHeader* header    = (PacketHeader*)( node->recv_buf + offset );
+        int           total_len = (int)ntohl( header->total_len );
+
+        // 길이 필드가 망가졌다면 이후 경계를 알 수 없으므로 복구 불가
+        if( total_len < min_len || total_len > DEFAULT_BUF_SIZE )
+        {
+            Metrics_AddParseError( ctx->metrics, PKT_ERR_LENGTH_MISMATCH );
+            result = DISPATCH_ERROR;
+            break;
+        }
+
+        // 아직 프레임이 다 도착하지 않음
+        if( node->recv_len - offset < total_len )
+            break;
+
+        // 핸드셰이크 응답: 첫 프레임이 오면 연결 수립. SEC_ACK 는 콜백에 전달하지 않는다.
+        // (ACK 를 보내지 않는 이전 클라이언트는 첫 메시지가 곧 응답이 된다)
+        if( node->state == CONN_AWAIT_HANDSHAKE_ACK )
+        {
+            node->state = CONN_ESTABLISHED;
+
+            if( strncmp( header->target, TARGET_SEC_ACK, TARGET_NAME_LEN ) == 0 )
+            {
+                Metrics_Add( ctx->metrics, METRIC_FRAMES_IN, 1 );
+                offset += total_len;
+                continue;
+            }
+        }
+
+        // Heartbeat 응답: 수신 시각은 이미 기록되었으므로 버린다.
+        if( strncmp( header->target, TARGET_HEARTBEAT_PONG, TARGET_NAME_LEN ) == 0 )
+        {
+            Metrics_Add( ctx->metrics, METRIC_FRAMES_IN, 1 );
+            offset += total_len;
+            continue;
+        }
+
+        // Run-to-Completion: 큐/스레드 전환 없이 바로 처리
+        if( ctx->config.dispatch_mode == SERVER_DISPATCH_INLINE )
+        {
+            HandleMessage( ctx, node->handle, node->recv_buf + offset, total_len );
+            offset += total_len;
+            continue;
+        }
+
+        ServerRecvTask* task = AllocRecvTask( ctx );
+
+        // 메모리 부족: 프레임을 남겨두고 잠시 뒤 다시 시도
+        if( !task )
+        {
+            result = DISPATCH_STALLED;
+            break;
+        }
+
+        memcpy( task->data, node->recv_buf + offset, total_len );
+
+        task->conn = node->handle;
+        task->len  = total_len;
+
+        batch_offset[batch_count] = offset;
+        batch[batch_count++]      = task;
+
+        offset += total_len;
+
+        if( batch_count == QUEUE_BATCH_SIZE )
+        {
+            int pushed = FlushRecvTasks( ctx, worker, batch, batch_count );
+            if( pushed < batch_count )
+            {
+                offset = batch_offset[pushed]; // 전달하지 못한 첫 프레임부터 다시 보낸다.
+                result = DISPATCH_STALLED;
+            }
+            batch_count = 0;
+        }
+    }
+
+    // 이번 수신에서 완성된 프레임을 한 번에 전달
+    if( batch_count > 0 )
+    {
+        int pushed = FlushRecvTasks( ctx, worker, batch, batch_count );
+        if( pushed < batch_count )
+        {
+            offset = batch_offset[pushed];
+            if( result == DISPATCH_OK )
+                result = DISPATCH_STALLED;
+        }
+    }
+
+    if( result == DISPATCH_ERROR )
+        return DISPATCH_ERROR;
+
+    // 소비한 프레임만큼 앞으로 당김
+    if( offset > 0 )
+    {
+        node->recv_len -= offset;
+        if( node->recv_len > 0 )
+            memmove( node->recv_buf, node->recv_buf + offset, node->recv_len );
+    }
+
+    return result;
+}
+
+/**
+ * ## Edge-Triggered 소켓을 EAGAIN까지 읽는다. (Reactor 전용)
+ * 한 번의 깨어남에서 READ_BUDGET_PER_WAKEUP 바이트까지만 읽어,
+ * 데이터를 쏟아내는 클라이언트 하나가 다른 연결을 굶기지 않도록 한다.
+ */
+static ReadResult ReadClient( TcpServerContext* ctx, ClientNode* node )
+{
+    ServerWorker* worker = WorkerOf( ctx, node );
+    int           budget = READ_BUDGET_PER_WAKEUP;
+
+    // 재개를 기다리는 중이면 수신 버퍼에 남은 프레임이 먼저 나가야 하므로 읽지 않는다.
+    if( node->read_paused )
+        return READ_PAUSED;
+
+    while( budget > 0 )
+    {
+        // 워커 큐가 high 워터마크를 넘었으면 더 읽지 않는다. (커널 버퍼에 남겨 TCP 흐름 제어에 맡김)
+        if( __atomic_load_n( &worker->read_paused, __ATOMIC_ACQUIRE ) )
+            return READ_PAUSED;
+
+        // DispatchFrames 가 DISPATCH_OK 면 남는 것은 불완전 프레임 1개뿐이므로 여유 공간은 0보다 크다.
+        int len = recv( node->fd, node->recv_buf + node->recv_len,
+                        DEFAULT_BUF_SIZE - node->recv_len, 0 );
+        if( len > 0 )
+        {
+            node->recv_len    += len;
+            node->last_recv_ms = node->reactor->now_ms;
+            budget            -= len;
+
+            Metrics_Add( ctx->metrics, METRIC_BYTES_IN, (uint64_t)len );
+
+            // 완성된 패킷 단위로 잘라 RecvQueue로 전달
+            DispatchResult dispatched = DispatchFrames( ctx, node );
+            if( dispatched == DISPATCH_ERROR   ) return READ_CLOSED;
+            if( dispatched == DISPATCH_STALLED ) return READ_PAUSED;
+        }
+        else if( len == 0 )
+        {
+            return READ_CLOSED; // 상대방 정상 종료
+        }
+        else
+        {
+            if( errno == EINTR ) continue;
+            if( errno == EAGAIN || errno == EWOULDBLOCK ) return READ_DRAINED;
+            return READ_CLOSED;
+        }
+    }
+
+    return READ_BUDGET;
+}
+
+/**
+ * ## 읽기 결과에 따라 연결을 정리하거나 Pending 리스트에 등록한다. (Reactor 전용)
+ * ET 모드에서는 남은 데이터에 대해 이벤트가 다시 오지 않으므로, 직접 기억해 두었다가 이어 읽는다.
+ */
+static void HandleReadResult( TcpServerContext* ctx, ClientNode* node, ReadResult result )
+{
+    if( result == READ_CLOSED )
+    {
+        CloseClient( ctx, node );
+    }
+    else if( result == READ_PAUSED )
+    {
+        PauseReads( ctx, node );
+    }
+    else if( result == READ_BUDGET )
+    {
+        if( !node->read_pending )
+        {
+            ServerReactor* reactor = node->reactor;
+
+            node->read_pending = true;
+            reactor->read_pending_fds[reactor->read_pending_count++] = node->fd;
+        }
+    }
+    else
+    {
+        node->read_pending = false;
+    }
+}
+
+static void UringResumeReads( ServerReactor* reactor, ClientNode* node );
+
+/**
+ * ##   읽기를 멈춘 연결 중 워커 큐가 low 워터마크 이하로 줄어든 것을 재개한다. (Reactor 전용, 루프마다)
+ * #### 수신 버퍼에 남은 프레임부터 전달한 뒤 소켓을 이어 읽는다. (ET 모드라 새 이벤트를 기다리지 않음)
+ */
+static void ResumePausedReads( ServerReactor* reactor )
+{
+    TcpServerContext* ctx  = reactor->ctx;
+    ClientNode*       node = reactor->paused_head;
+
+    while( node )
+    {
+        // 처리 중 노드가 닫히거나 다시 목록 앞에 등록될 수 있으므로 다음 노드를 먼저 기억한다.
+        ClientNode*   next   = node->paused_next;
+        ServerWorker* worker = WorkerOf( ctx, node );
+
+        CheckLowWatermark( ctx, worker );
+
+        if( !__atomic_load_n( &worker->read_paused, __ATOMIC_ACQUIRE ) && !node->closing )
+        {
+            UnpauseReads( ctx, node );
+
+            if( ctx->io_backend == SERVER_IO_URING )
+            {
+                UringResumeReads( reactor, node );
+            }
+            else
+            {
+                DispatchResult dispatched = DispatchFrames( ctx, node );
+
+                if( dispatched == DISPATCH_ERROR )        CloseClient( ctx, node );
+                else if( dispatched == DISPATCH_STALLED ) PauseReads( ctx, node );
+                else                                      HandleReadResult( ctx, node, ReadClient( ctx, node ) );
+            }
+        }
+
+        node = next;
+    }
+}
+
+
+// --------------------------------------------------------------------------
+// 6. 연결별 송신 대기열 (Outbound Queue)
+//    Non-blocking 소켓의 부분 전송(Short Write)과 EAGAIN을 처리하여 프레임이 잘리지 않게 한다.
+//    보내지 못한 나머지는 참조 카운트 버퍼(SharedBuffer) 세그먼트로 보관한다.
+// --------------------------------------------------------------------------
+
+#define OUT_FLUSH_IOV_MAX 64 // FlushClient 가 한 번의 sendmsg 로 묶는 최대 세그먼트 수
+
+/**
+ * ## EPOLLOUT 감시를 켜거나 끈다. (out_mutex 보유 상태에서 호출)
+ * epoll_ctl은 스레드 안전하므로 Sender 스레드에서도 호출 가능하다.
+ */
+static void SetWriteInterest( ClientNode* node, bool enable )
+{
+    if( node->out_armed == enable )
+        return;
+
+    struct epoll_event ev;
+    ev.events  = EPOLLIN | EPOLLET | ( enable ? EPOLLOUT : 0 );
+    ev.data.fd = node->fd;
+
+    if( epoll_ctl( node->reactor->epoll_fd, EPOLL_CTL_MOD, node->fd, &ev ) == 0 )
+        node->out_armed = enable;
+}
+
+/**
+ * ## 버퍼의 offset 이후를 대기열 끝에 덧붙인다. 성공 시 대기열이 참조를 하나 가진다. (out_mutex 보유)
+ */
+static bool QueueSegment( ClientNode* node, SharedBuffer* buf, int offset )
+{
+    OutSegment* seg = (OutSegment*)malloc( sizeof( OutSegment ) );
+    if( !seg )
+        return false;
+
+    SharedBuffer_Retain( buf );
+
+    seg->buf    = buf;
+    seg->offset = offset;
+    seg->next   = NULL;
+
+    if( node->out_tail ) { node->out_tail->next = seg; }
+    else                 { node->out_head       = seg; }
+
+    node->out_tail  = seg;
+    node->out_len  += buf->len - offset;
+
+    return true;
+}
+
+/**
+ * ## 대기열 앞에서 sent 바이트를 소비하고, 다 보낸 세그먼트를 해제한다. (out_mutex 보유)
+ */
+static void ConsumeOutbound( ClientNode* node, int sent )
+{
+    node->out_len -= sent;
+
+    while( sent > 0 && node->out_head )
+    {
+        OutSegment* seg    = node->out_head;
+        int         remain = seg->buf->len - seg->offset;
+
+        if( sent < remain )
+        {
+            seg->offset += sent;
+            break;
+        }
+
+        sent          -= remain;
+        node->out_head = seg->next;
+
+        SharedBuffer_Release( seg->buf );
+        free( seg );
+    }
+
+    if( !node->out_head )
+        node->out_tail = NULL;
+}
+
+/**
+ * ## 남은 바이트를 Reactor가 소켓이 쓰기 가능해질 때 보내도록 예약한다. (out_mutex 보유)
+ */
+static void UringArmWrite( ClientNode* node );
+
+static void ArmWrite( TcpServerContext* ctx, ClientNode* node )
+{
+    if( ctx->io_backend == SERVER_IO_URING )
+        UringArmWrite( node );
+    else
+        SetWriteInterest( node, true );
+}
+
+/**
+ * ## 송신 스레드가 한 배치를 처리하는 동안 프레임을 모아둔 연결 목록
+ * 배치가 끝나면 연결마다 모인 프레임을 한 번의 sendmsg 로 보낸다. (Coalescing)
+ */
+typedef struct
+{
+    ClientNode** nodes;
+    int          count;
+    int          capacity;
+} SendBatch;
+
+/**
+ * ##   대기열을 세그먼트 여러 개씩 한 번의 sendmsg 로 묶어 EAGAIN 이 나거나 모두 보낼 때까지 보낸다. (out_mutex 보유)
+ * #### 연결이 끊겼으면 남은 데이터를 버린다.
+ *
+ * Return: 남은 바이트가 없으면 true
+ */
+static bool SendOutboundLocked( TcpServerContext* ctx, ClientNode* node, int flags )
+{
+    while( node->out_len > 0 )
+    {
+        struct iovec iov[OUT_FLUSH_IOV_MAX];
+        int          iov_count = 0;
+        int          requested = 0;
+
+        for( OutSegment* seg = node->out_head; seg && iov_count < OUT_FLUSH_IOV_MAX; seg = seg->next )
+        {
+            iov[iov_count].iov_base = seg->buf->data + seg->offset;
+            iov[iov_count].iov_len  = seg->buf->len - seg->offset;
+            requested += (int)iov[iov_count].iov_len;
+            iov_count++;
+        }
+
+        struct msghdr msg;
+        memset( &msg, 0, sizeof( msg ) );
+        msg.msg_iov    = iov;
+        msg.msg_iovlen = iov_count;
+
+        int sent = (int)sendmsg( node->fd, &msg, MSG_NOSIGNAL | MSG_DONTWAIT | flags );
+
+        if( sent > 0 )
+        {
+            Metrics_Add( ctx->metrics, METRIC_BYTES_OUT, (uint64_t)sent );
+            if( sent < requested )
+                Metrics_Add( ctx->metrics, METRIC_PARTIAL_WRITES, 1 );
+
+            ConsumeOutbound( node, sent );
+        }
+        else if( sent < 0 && errno == EINTR )
+        {
+            continue;
+        }
+        else if( sent < 0 && ( errno == EAGAIN || errno == EWOULDBLOCK ) )
+        {
+            return false; // 다시 EPOLLOUT 대기
+        }
+        else
+        {
+            // 연결 끊김: 남은 데이터는 의미가 없으므로 버린다.
+            DropOutbound( node );
+        }
+    }
+
+    return true;
+}
+
+/**
+ * ##   모아둔(보내지 않고 붙여만 둔) 대기열을 지금 보낸다. (out_mutex 보유)
+ * #### Reactor가 이미 쓰기 대기 중이면(out_armed) 그쪽에 맡긴다. (io_uring 전송 중인 세그먼트와 겹치지 않도록)
+ * #### flags 에 MSG_MORE 를 주면 커널이 뒤따를 데이터와 합쳐 세그먼트를 만들 수 있다.
+ */
+static void FlushHeldLocked( TcpServerContext* ctx, ClientNode* node, int flags )
+{
+    if( node->closed || node->out_armed || node->out_len == 0 )
+        return;
+
+    if( !SendOutboundLocked( ctx, node, flags ) )
+        ArmWrite( ctx, node );
+}
+
+/**
+ * ## 완성된 프레임 하나를 클라이언트에게 보낸다. (Thread-Safe, Non-blocking)
+ *
+ * - 밀린 데이터가 없으면 바로 sendmsg() 하고, 남은 바이트만 대기열에 보관한 뒤 EPOLLOUT을 등록한다.
+ * - 밀린 데이터가 있으면 순서를 지키기 위해 대기열 뒤에 붙인다.
+ * - 대기열 한도(outbound_buffer_size)를 넘으면 프레임을 통째로 버린다. (스트림이 잘리는 것보다 안전)
+ * - batch 가 있거나 연결이 Cork 상태면 보내지 않고 대기열에 모아만 둔다. (배치 끝 또는 Uncork 시 한 번에 전송)
+ *   모인 양이 send_coalesce_bytes 에 닿으면 그 자리에서 보낸다.
+ *
+ * 남은 바이트는 shared 가 있으면 그 참조를 대기열에 넣고(복사 없음), 없으면 새 버퍼에 복사한다.
+ *
+ * Return: true(전송 또는 예약 완료), false(Drop)
+ */
+static bool WriteFrame( TcpServerContext* ctx, ClientNode* node, const PacketFrame* frame, SharedBuffer* shared,
+                        SendBatch* batch )
+{
+    const int capacity = ctx->config.outbound_buffer_size;
+    const int len      = frame->total_len;
+    bool      result   = true;
+
+    pthread_mutex_lock( &node->out_mutex );
+    {
+        int  sent = 0;
+        bool hold = ( node->cork_depth > 0 );
+
+        // 배치에 등록할 자리가 없으면 모으지 않고 바로 보낸다.
+        if( batch && !hold && ( node->in_send_batch || batch->count < batch->capacity ) )
+            hold = true;
+        else
+            batch = NULL;
+
+        // 이미 닫힌 연결 (FD가 재사용되었을 수 있으므로 절대 쓰지 않음)
+        if( node->closed )
+            result = false;
+
+        if( result && node->out_len == 0 && !hold )
+        {
+            struct msghdr msg;
+            memset( &msg, 0, sizeof( msg ) );
+            msg.msg_iov    = (struct iovec*)frame->iov;
+            msg.msg_iovlen = frame->iov_count;
+
+            // MSG_NOSIGNAL: 상대방 연결 끊김 시 SIGPIPE 시그널 발생 방지
+            sent = (int)sendmsg( node->fd, &msg, MSG_NOSIGNAL | MSG_DONTWAIT );
+
+            if( sent < 0 )
+            {
+                // EAGAIN 외의 에러는 연결 종료 상황. 정리는 Reactor의 수신 경로가 담당한다.
+                if( errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR )
+                    result = false;
+                sent = 0;
+            }
+
+            if( sent > 0 )
+                Metrics_Add( ctx->metrics, METRIC_BYTES_OUT, (uint64_t)sent );
+            if( result && sent < len )
+                Metrics_Add( ctx->metrics, METRIC_PARTIAL_WRITES, 1 ); // 나머지는 대기열로
+        }
+
+        int remain = len - sent;
+
+        // 모으는 중 한도를 넘길 프레임이면 모아둔 것을 먼저 보내 자리를 만든다.
+        if( result && hold && capacity - node->out_len < remain )
+            FlushHeldLocked( ctx, node, MSG_MORE );
+
+        if( result && remain > 0 )
+        {
+            // 빈 대기열에서 시작했다면 프레임 크기(<= DEFAULT_BUF_SIZE)는 항상 들어간다.
+            if( capacity - node->out_len < remain )
+            {
+                result = false;
+            }
+            else if( shared )
+            {
+                // 공유 프레임: 참조만 추가
+                result = QueueSegment( node, shared, sent );
+            }
+            else
+            {
+                // 단독 프레임: 남은 바이트만 새 버퍼에 모은다.
+                SharedBuffer* rest = SharedBuffer_Create( remain );
+
+                if( rest )
+                {
+                    int skip = sent;
+
+                    for( int i = 0; i < frame->iov_count; ++i )
+                    {
+                        const char* base = (const char*)frame->iov[i].iov_base;
+                        int         part = (int)frame->iov[i].iov_len;
+
+                        if( skip >= part ) { skip -= part; continue; }
+
+                        memcpy( rest->data + rest->len, base + skip, part - skip );
+                        rest->len += part - skip;
+                        skip = 0;
+                    }
+
+                    result = QueueSegment( node, rest, 0 );
+                    SharedBuffer_Release( rest ); // 성공 시 대기열이 참조를 가짐
+                }
+                else
+                {
+                    result = false;
+                }
+            }
+
+            if( result && !hold )
+                ArmWrite( ctx, node );
+        }
+
+        if( result && hold )
+        {
+            // 배치 끝에 보내도록 등록 (같은 배치에서 한 번만)
+            if( batch && !node->in_send_batch )
+            {
+                node->in_send_batch = true;
+                batch->nodes[batch->count++] = node;
+            }
+
+            // 바이트 한도에 닿았으면 지금 보낸다. (뒤에 더 올 예정이므로 MSG_MORE)
+            int budget = ( ctx->config.send_coalesce_bytes > 0 ) ? ctx->config.send_coalesce_bytes : capacity;
+            if( node->out_len >= budget )
+                FlushHeldLocked( ctx, node, MSG_MORE );
+        }
+    }
+    pthread_mutex_unlock( &node->out_mutex );
+
+    Metrics_Add( ctx->metrics, result ? METRIC_FRAMES_OUT : METRIC_SEND_DROPS, 1 );
+    return result;
+}
+
+/**
+ * ## 송신 배치 동안 모아둔 연결들의 대기열을 연결마다 한 번의 sendmsg 로 보낸다. (Sender 전용, 배치와 같은 읽기 구간 안)
+ * Cork 중인 연결은 Uncork 가 보낸다.
+ */
+static void FlushSendBatch( TcpServerContext* ctx, SendBatch* batch )
+{
+    for( int i = 0; i < batch->count; ++i )
+    {
+        ClientNode* node = batch->nodes[i];
+
+        pthread_mutex_lock( &node->out_mutex );
+        {
+            node->in_send_batch = false;
+
+            if( node->cork_depth == 0 )
+                FlushHeldLocked( ctx, node, 0 );
+        }
+        pthread_mutex_unlock( &node->out_mutex );
+    }
+
+    batch->count = 0;
+}
+
+/**
+ * ## 소켓이 쓰기 가능해졌을 때 대기열을 비운다. (Reactor 전용)
+ * 여러 세그먼트를 한 번의 sendmsg 로 묶어 보내며, 모두 비우면 EPOLLOUT 감시를 해제한다.
+ */
+static void FlushClient( TcpServerContext* ctx, ClientNode* node )
+{
+    pthread_mutex_lock( &node->out_mutex );
+    {
+        SendOutboundLocked( ctx, node, 0 );
+
+        if( node->out_len == 0 && !node->closed )
+            SetWriteInterest( node, false );
+    }
+    pthread_mutex_unlock( &node->out_mutex );
+}
+
+/**
+ * ##   대기열 맨 앞의 핸드셰이크(와 그 사이 도착한 송신)를 Non-blocking 으로 보낸다. (소유 Reactor, IO 등록 직후)
+ * #### 소켓이 가득 차면 나머지는 일반 송신과 같이 쓰기 대기 후 Reactor가 이어 보낸다.
+ */
+static void StartHandshake( TcpServerContext* ctx, ClientNode* node )
+{
+    pthread_mutex_lock( &node->out_mutex );
+    FlushHeldLocked( ctx, node, 0 );
+    pthread_mutex_unlock( &node->out_mutex );
+}
+
+
+// --------------------------------------------------------------------------
+// 7. 워커 스레드 (Worker Thread)
+//    수신된 Raw 데이터를 파싱하고 사용자 콜백을 호출한다.
+// --------------------------------------------------------------------------
+
+/**
+ * ## 타이머를 목록에서 빼고 해제한다. (timer_mutex 보유)
+ */
+static void FreeServerTimerLocked( TcpServerContext* ctx, ServerTimer* timer )
+{
+    TimerWheel_Cancel( ctx->timer_wheel, &timer->entry );
+
+    if( timer->prev ) timer->prev->next = timer->next;
+    else              ctx->timer_list   = timer->next;
+
+    if( timer->next ) timer->next->prev = timer->prev;
+
+    free( timer );
+}
+
+/**
+ * ## 워커(또는 Reactor)가 실행을 마쳤거나 맡기지 못한 타이머를 정리한다. 일회성이거나 취소된 타이머는 해제한다.
+ */
+static void FinishServerTimer( TcpServerContext* ctx, ServerTimer* timer )
+{
+    pthread_mutex_lock( &ctx->timer_mutex );
+    {
+        timer->busy = false;
+
+        if( timer->cancelled || timer->interval_ms == 0 )
+            FreeServerTimerLocked( ctx, timer );
+    }
+    pthread_mutex_unlock( &ctx->timer_mutex );
+}
+
+/**
+ * ## 만료된 사용자 타이머의 콜백을 실행한다. (워커 0, INLINE 모드는 Reactor 0)
+ * 콜백 안에서 Schedule/Cancel 을 부를 수 있도록 Lock 밖에서 실행한다.
+ */
+static void RunServerTimer( TcpServerContext* ctx, ServerTimer* timer )
+{
+    pthread_mutex_lock( &ctx->timer_mutex );
+    bool cancelled = timer->cancelled;
+    pthread_mutex_unlock( &ctx->timer_mutex );
+
+    if( !cancelled )
+        timer->callback( ctx, ctx->service_ctx, timer->arg );
+
+    FinishServerTimer( ctx, timer );
+}
+
+static void* WorkerThreadFunc( void* arg )
+{
+    ServerWorker*     worker = (ServerWorker*)arg;
+    TcpServerContext* ctx    = worker->ctx;
+
+    ServerRecvTask* batch[QUEUE_BATCH_SIZE];
+    bool            stop = false;
+
+    while( ctx->is_running && !stop )
+    {
+        // 1. 큐에서 작업을 한 번에 여러 개 가져오기 (Blocking, Lock 1회)
+        int count = SafeQueue_DequeueBatch( worker->recv_queue, (void**)batch, QUEUE_BATCH_SIZE );
+
+        if( count == 0 )
+            break;
+
+        // 큐가 충분히 줄었으면 멈춰 있던 읽기를 재개시킨다. (Reactor가 다음 루프에서 이어 읽음)
+        CheckLowWatermark( ctx, worker );
+
+        for( int i = 0; i < count; ++i )
+        {
+            ServerRecvTask* task = batch[i];
+
+            // 사용자 타이머 만료 (종료 중이면 실행하지 않음, 타이머는 Destroy 가 해제)
+            if( task->timer && !stop )
+            {
+                RunServerTimer( ctx, task->timer );
+                FreeRecvTask( task );
+                continue;
+            }
+
+            // 2. 종료 신호(Poison Pill) 확인
+            // 핸들이 없는 경우 종료로 간주하고, 같은 배치의 나머지 작업은 처리하지 않고 해제만 한다.
+            if( stop || task->conn == CONN_HANDLE_INVALID )
+            {
+                stop = true;
+                FreeRecvTask( task );
+                continue;
+            }
+
+            // 3. 패킷 파싱 + 사용자 콜백 (In-place decryption을 위해 task->data(힙 메모리)를 바로 넘김)
+            HandleMessage( ctx, task->conn, task->data, task->len );
+
+            // 4. 작업 메모리 해제
+            FreeRecvTask( task );
+        }
+    }
+
+    return NULL;
+}
+
+
+// --------------------------------------------------------------------------
+// 8. 송신 스레드 (Sender Thread)
+// 설명: 전송 요청을 직렬화하여 소켓에 쓴다. (Broadcast 지원)
+// --------------------------------------------------------------------------
+
+/**
+ * ##   프레임을 한 번만 직렬화한 공유 버퍼를 모든 연결에 보낸다.
+ * #### 레지스트리는 Epoch 읽기 구간 안에서 Lock 없이 순회하므로, 전송 중에도 Accept/Close가 막히지 않는다.
+ * #### 순회 내내 연결되어 있던 연결은 정확히 한 번씩 받는다. (도중에 닫힌 연결은 closed 로 걸러짐)
+ * #### 느린 연결은 공유 버퍼의 참조만 대기열에 넣는다. (연결 수만큼 복사/암호화하지 않음)
+ */
+static void BroadcastFrame( TcpServerContext* ctx, const PacketFrame* frame, SendBatch* batch )
+{
+    // 1. 직렬화 (암호화는 frame 구성 시 이미 1회 수행됨)
+    SharedBuffer* shared = SharedBuffer_Create( frame->total_len );
+    PacketFrame   flat;
+
+    if( shared )
+    {
+        for( int i = 0; i < frame->iov_count; ++i )
+        {
+            memcpy( shared->data + shared->len, frame->iov[i].iov_base, frame->iov[i].iov_len );
+            shared->len += (int)frame->iov[i].iov_len;
+        }
+
+        flat.iov[0].iov_base = shared->data;
+        flat.iov[0].iov_len  = shared->len;
+        flat.iov_count       = 1;
+        flat.total_len       = shared->len;
+        frame                = &flat;
+    }
+
+    // 2. 전송 (Lock 없이, 각 연결의 out_mutex만 사용)
+    int guard = Epoch_Enter( ctx->client_epoch );
+    int high  = __atomic_load_n( &ctx->client_high_fd, __ATOMIC_ACQUIRE );
+
+    for( int fd = 0; fd < high; ++fd )
+    {
+        ClientNode* node = LookupClient( ctx, fd );
+        if( node )
+            WriteFrame( ctx, node, frame, shared, batch );
+    }
+
+    Epoch_Exit( ctx->client_epoch, guard );
+
+    SharedBuffer_Release( shared );
+}
+
+/**
+ * ## 전송 요청 하나를 프레임으로 만들어 대상 연결(들)에 쓴다.
+ * from_queue 가 true면 SendQueue 에서 꺼낸 요청이므로, 쓴 뒤 대기 카운트(send_queued, pending_broadcasts)를 내린다.
+ * batch 가 있으면 보내지 않고 모아둔다. (FlushSendBatch 에서 전송)
+ *
+ * Return: false(프레임 생성 실패, 또는 유니캐스트 대상이 없거나 Drop 됨)
+ */
+static bool ProcessSendTask( TcpServerContext* ctx, ServerSendTask* task, char* enc_buf, bool from_queue,
+                             SendBatch* batch )
+{
+    // 프레임 구성 (헤더/체크섬만 생성, 바디는 복사 없이 참조하거나 한 번에 복사+암호화)
+    PacketFrame frame;
+    int packet_len
+        = Packet_BuildFrame( &frame, task->target, task->body_data, task->body_len,
+                             ctx->encrypt_fn, enc_buf );
+
+    if( task->is_broadcast )
+    {
+        // A. 브로드캐스트 전송
+        if( packet_len > 0 )
+            BroadcastFrame( ctx, &frame, batch );
+
+        if( from_queue )
+            __atomic_sub_fetch( &ctx->pending_broadcasts, 1, __ATOMIC_RELEASE );
+
+        return ( packet_len > 0 );
+    }
+    else
+    {
+        // B. 유니캐스트 전송 (읽기 구간 안에서 Lock 없이 쓴다)
+        // 대상이 이미 끊겼거나 FD가 다른 연결에 재사용되었으면 세대가 달라 찾지 못하고 버려진다.
+        int         guard  = Epoch_Enter( ctx->client_epoch );
+        ClientNode* node   = LookupConn( ctx, task->conn );
+        bool        result = ( node != NULL ) && ( packet_len > 0 ) && WriteFrame( ctx, node, &frame, NULL, batch );
+
+        // 대상이 없어 버려진 경우 (WriteFrame 의 Drop 은 그 안에서 셈)
+        if( !node )
+            Metrics_Add( ctx->metrics, METRIC_SEND_DROPS, 1 );
+
+        // 쓴 뒤에 내려야 이후의 직접 쓰기가 이 프레임을 앞지르지 않는다.
+        if( node && from_queue )
+            __atomic_sub_fetch( &node->send_queued, 1, __ATOMIC_RELEASE );
+
+        Epoch_Exit( ctx->client_epoch, guard );
+        return result;
+    }
+}
+
+static void* SenderThreadFunc( void* arg )
+{
+    TcpServerContext* ctx = (TcpServerContext*)arg;
+
+    // 암호화된 바디용 임시 버퍼 (스레드 로컬, 평문 전략에서는 사용하지 않음)
+    char* enc_buf = (char*)malloc( DEFAULT_BUF_SIZE );
+    if( !enc_buf )
+        return NULL;
+
+    // 배치 동안 프레임을 모아둔 연결 목록 (연결마다 최대 1칸이므로 테이블 크기면 충분, 할당 실패 시 묶지 않음)
+    SendBatch coalesce;
+    coalesce.count    = 0;
+    coalesce.capacity = ( ctx->config.send_coalesce_bytes > 0 ) ? ctx->client_table_size : 0;
+    coalesce.nodes    = ( coalesce.capacity > 0 ) ? (ClientNode**)malloc( sizeof( ClientNode* ) * coalesce.capacity ) : NULL;
+
+    if( !coalesce.nodes )
+        coalesce.capacity = 0;
+
+    ServerSendTask* batch[QUEUE_BATCH_SIZE];
+    bool            stop = false;
+
+    while( ctx->is_running && !stop )
+    {
+        // 1. 큐에서 전송 요청을 한 번에 여러 개 가져오기 (Blocking, Lock 1회)
+        int count = SafeQueue_DequeueBatch( ctx->send_queue, (void**)batch, QUEUE_BATCH_SIZE );
+
+        if( count == 0 )
+            break;
+
+        // 요청이 2개 이상이면 연결마다 프레임을 모아 배치 끝에 한 번의 sendmsg 로 보낸다.
+        // (이미 큐에 쌓인 것만 묶으므로 추가 대기 지연은 없음. 모아둔 노드는 이 읽기 구간이 끝날 때까지 해제되지 않음)
+        SendBatch* pending = ( count > 1 && coalesce.capacity > 0 ) ? &coalesce : NULL;
+        int        guard   = Epoch_Enter( ctx->client_epoch );
+
+        for( int i = 0; i < count; ++i )
+        {
+            ServerSendTask* task = batch[i];
+
+            // 2. 종료 신호 확인 (대상 없는 유니캐스트, 이후 요청은 해제만 한다)
+            if( !task->is_broadcast && task->conn == CONN_HANDLE_INVALID )
+                stop = true;
+
+            // 3. 전송 (또는 모으기)
+            if( !stop )
+                ProcessSendTask( ctx, task, enc_buf, true, pending );
+
+            // 작업 완료 후 해제
+            FreeSendTask( task );
+        }
+
+        // 4. 모아둔 연결별 전송
+        if( pending )
+            FlushSendBatch( ctx, pending );
+
+        Epoch_Exit( ctx->client_epoch, guard );
+    }
+
+    free( coalesce.nodes );
+    free( enc_buf );
+    return NULL;
+}
+
+
+// --------------------------------------------------------------------------
+// 9. IO 스레드 (Reactor)
+//    연결 수락 및 데이터 수신을 담당한다. Reactor 수만큼 병렬로 동작한다.
+// --------------------------------------------------------------------------
+
+/**
+ * ## Reactor의 리스너 소켓을 생성한다. (백엔드 공통)
+ * 여러 Reactor가 같은 포트에 바인딩할 수 있도록 SO_REUSEPORT를 설정한다.
+ */
+static bool OpenListener( ServerReactor* reactor, int port )
+{
+    TcpServerContext* ctx = reactor->ctx;
+
+    // 공유 모드: Reactor 0 의 리스너를 복제해 같은 Accept 대기열을 함께 감시한다. (해제는 Reactor마다 따로)
+    if( ctx->config.listener_mode == SERVER_LISTEN_SHARED && reactor->index > 0 )
+    {
+        reactor->listen_fd = fcntl( ctx->reactors[0].listen_fd, F_DUPFD_CLOEXEC, 0 );
+        return reactor->listen_fd >= 0;
+    }
+
+    // Listen 소켓 생성 (Epoll 처리를 위해 Non-blocking)
+    reactor->listen_fd = socket( AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0 );
+    if( reactor->listen_fd < 0 )
+        return false;
+
+    // 주소 재사용 옵션 (서버 재시작 시 Bind Error 방지)
+    int opt = 1;
+    setsockopt( reactor->listen_fd, SOL_SOCKET, SO_REUSEADDR, &opt, sizeof( opt ) );
+
+    // 포트 공유 옵션 (Reactor별 리스너에 커널이 연결을 해시 분산)
+    if( setsockopt( reactor->listen_fd, SOL_SOCKET, SO_REUSEPORT, &opt, sizeof( opt ) ) < 0 )
+    {
+        perror( "[TcpServer] SO_REUSEPORT failed" );
+        return false;
+    }
+
+    // 바인딩
+    struct sockaddr_in addr;
+    memset( &addr, 0, sizeof( addr ) );
+
+    addr.sin_family      = AF_INET;
+    addr.sin_addr.s_addr = INADDR_ANY;
+    addr.sin_port        = htons( port );
+
+    if( bind( reactor->listen_fd, (struct sockaddr*)&addr, sizeof( addr ) ) < 0 )
+    {
+        perror( "[TcpServer] Bind failed" );
+        return false;
+    }
+
+    if( listen( reactor->listen_fd, ctx->config.listen_backlog ) < 0 )
+    {
+        perror( "[TcpServer] Listen failed" );
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * ## Reactor의 Epoll 인스턴스를 생성하고 리스너를 등록한다.
+ */
+static bool InitEpollReactor( ServerReactor* reactor )
+{
+    // Epoll 생성
+    reactor->epoll_fd = epoll_create1( 0 );
+    if( reactor->epoll_fd < 0 )
+        return false;
+
+    // Epoll에 Listen 소켓 등록
+    struct epoll_event ev;
+    ev.events  = EPOLLIN; // 읽기 이벤트 감지
+    ev.data.fd = reactor->listen_fd;
+
+    int added = -1;
+
+#ifdef EPOLLEXCLUSIVE
+    // 공유 리스너: 새 연결마다 모든 Reactor가 깨어나지 않도록 하나만 깨운다. (커널 4.5+, 미지원 시 일반 등록)
+    if( reactor->ctx->config.listener_mode == SERVER_LISTEN_SHARED && reactor->ctx->reactor_count > 1 )
+    {
+        ev.events = EPOLLIN | EPOLLEXCLUSIVE;
+        added     = epoll_ctl( reactor->epoll_fd, EPOLL_CTL_ADD, reactor->listen_fd, &ev );
+        ev.events = EPOLLIN;
+    }
+#endif
+
+    if( added < 0 && epoll_ctl( reactor->epoll_fd, EPOLL_CTL_ADD, reactor->listen_fd, &ev ) < 0 )
+    {
+        perror( "[TcpServer] Epoll control failed" );
+        return false;
+    }
+
+    // 깨우기용 eventfd 등록 (Level-Triggered: 읽어서 비울 때까지 계속 보고됨)
+    reactor->wake_fd = eventfd( 0, EFD_NONBLOCK | EFD_CLOEXEC );
+    if( reactor->wake_fd < 0 )
+        return false;
+
+    ev.events  = EPOLLIN;
+    ev.data.fd = reactor->wake_fd;
+
+    if( epoll_ctl( reactor->epoll_fd, EPOLL_CTL_ADD, reactor->wake_fd, &ev ) < 0 )
+    {
+        perror( "[TcpServer] Epoll control failed" );
+        return false;
+    }
+
+    // Epoll 이벤트 버퍼 및 이어 읽기 리스트 할당
+    // (연결당 최대 1회 등록되므로 FD 테이블 크기면 충분)
+    int table_size = reactor->ctx->client_table_size;
+
+    reactor->events            = (struct epoll_event*)malloc( sizeof( struct epoll_event ) * MAX_EPOLL_EVENTS );
+    reactor->read_pending_fds  = (int*)malloc( sizeof( int ) * table_size );
+    reactor->read_pending_swap = (int*)malloc( sizeof( int ) * table_size );
+
+    return reactor->events && reactor->read_pending_fds && reactor->read_pending_swap;
+}
+
+static void DestroyUringReactor( ServerReactor* reactor );
+
+/**
+ * ## Reactor의 자원을 해제한다. (루프가 멈춘 뒤 호출)
+ */
+static void DestroyReactor( ServerReactor* reactor )
+{
+    DestroyUringReactor( reactor );
+
+    if( reactor->listen_fd >= 0 ) close( reactor->listen_fd );
+    if( reactor->epoll_fd  >= 0 ) close( reactor->epoll_fd  );
+    if( reactor->wake_fd   >= 0 ) close( reactor->wake_fd   );
+
+    reactor->wake_fd = -1;
+
+    TimerWheel_Destroy( reactor->timers );
+    reactor->timers = NULL;
+
+    free( reactor->events );
+    free( reactor->read_pending_fds );
+    free( reactor->read_pending_swap );
+}
+
+/**
+ * ##   Accept 대기열이 빌 때까지(EAGAIN) 연결을 수락한다. (Epoll Reactor 전용)
+ * #### accept4 로 Non-blocking/CLOEXEC 를 함께 설정해 연결당 fcntl 호출을 없앤다.
+ * #### 재접속이 몰릴 때 이벤트 한 번에 쌓인 연결을 모두 받아 대기열이 넘치지 않게 한다.
+ */
+static void AcceptClients( ServerReactor* reactor )
+{
+    TcpServerContext* ctx = reactor->ctx;
+
+    for( ;; )
+    {
+        int client_fd = accept4( reactor->listen_fd, NULL, NULL, SOCK_NONBLOCK | SOCK_CLOEXEC );
+
+        if( client_fd < 0 )
+        {
+            // 수락 전에 상대가 끊은 연결은 건너뛰고 계속 받는다.
+            if( errno == EINTR || errno == ECONNABORTED ) continue;
+
+            // EAGAIN: 대기열이 비었음. 그 외(EMFILE 등)는 다음 이벤트에서 다시 시도한다.
+            return;
+        }
+
+        // 세션 생성 실패 (FD 한도 초과, 메모리 부족) 시 즉시 거절
+        ClientNode* node = AddClient( ctx, reactor, client_fd );
+        if( !node )
+        {
+            close( client_fd );
+            continue;
+        }
+
+        struct epoll_event ev;
+        ev.events  = EPOLLIN | EPOLLET;
+        ev.data.fd = client_fd;
+
+        epoll_ctl( reactor->epoll_fd, EPOLL_CTL_ADD, client_fd, &ev );
+
+        // 핸드셰이크 전송 (Non-blocking, 나머지는 EPOLLOUT 으로)
+        StartHandshake( ctx, node );
+    }
+}
+
+/**
+ * ##   사용자 타이머 만료 (Reactor 0 의 TimerWheel_Advance 안, timer_mutex 보유)
+ * #### 주기 타이머는 바로 다음 회차를 등록하고, 실행은 Lock 을 놓은 뒤 DispatchServerTimers 가 맡긴다.
+ */
+static void OnServerTimerExpired( void* arg )
+{
+    ServerTimer*      timer = (ServerTimer*)arg;
+    TcpServerContext* ctx   = timer->ctx;
+    uint64_t          now   = ctx->reactors[0].now_ms;
+
+    if( timer->interval_ms > 0 )
+    {
+        // 고정 주기: 이전 만료 시각 기준. 한 주기 이상 밀렸으면 지금부터 다시 센다.
+        timer->due_ms += (uint64_t)timer->interval_ms;
+        if( timer->due_ms <= now )
+            timer->due_ms = now + (uint64_t)timer->interval_ms;
+
+        TimerWheel_Schedule( ctx->timer_wheel, &timer->entry, now, timer->due_ms - now );
+    }
+
+    // 이전 회차가 아직 워커에 있으면 건너뛴다. (느린 워커의 큐에 틱이 쌓이지 않도록)
+    if( timer->busy )
+        return;
+
+    timer->busy       = true;
+    timer->fired_next = ctx->reactors[0].fired_timers;
+    ctx->reactors[0].fired_timers = timer;
+}
+
+/**
+ * ##   만료된 사용자 타이머를 돌리고 실행을 워커 0 에 맡긴다. (Reactor 0 전용, 루프마다)
+ * #### 수신 태스크로 감싸 RecvQueue 에 넣으므로 콜백은 메시지 처리와 같은 스레드에서 순서대로 실행된다.
+ */
+static void DispatchServerTimers( ServerReactor* reactor )
+{
+    TcpServerContext* ctx = reactor->ctx;
+
+    if( reactor->index != 0 )
+        return;
+
+    pthread_mutex_lock( &ctx->timer_mutex );
+    TimerWheel_Advance( ctx->timer_wheel, reactor->now_ms );
+    ServerTimer* fired = reactor->fired_timers;
+    reactor->fired_timers = NULL;
+    pthread_mutex_unlock( &ctx->timer_mutex );
+
+    // 만료 순서대로 실행되도록 뒤집는다.
+    ServerTimer* ordered = NULL;
+    while( fired )
+    {
+        ServerTimer* next = fired->fired_next;
+        fired->fired_next = ordered;
+        ordered           = fired;
+        fired             = next;
+    }
+
+    while( ordered )
+    {
+        ServerTimer* timer = ordered;
+        ordered = timer->fired_next;
+
+        if( ctx->config.dispatch_mode == SERVER_DISPATCH_INLINE )
+        {
+            RunServerTimer( ctx, timer );
+            continue;
+        }
+
+        ServerRecvTask* task = AllocRecvTask( ctx );
+        if( task )
+        {
+            task->timer = timer;
+            if( SafeQueue_Enqueue( ctx->workers[0].recv_queue, task ) )
+                continue;
+
+            FreeRecvTask( task );
+        }
+
+        // 큐가 가득 참: 이번 회차는 버린다. (주기 타이머는 다음 회차에 다시 실행)
+        FinishServerTimer( ctx, timer );
+    }
+}
+
+static void UringCloseClient( TcpServerContext* ctx, ClientNode* node );
+
+/**
+ * ##   연결의 유휴 타이머를 다음 확인 시각에 등록한다. (소유 Reactor 전용)
+ * #### 유휴 타임아웃 시각과 다음 Heartbeat 시각 중 빠른 쪽. 둘 다 꺼져 있으면 등록하지 않는다.
+ */
+static void ScheduleIdleTimer( ServerReactor* reactor, ClientNode* node )
+{
+    const TcpServerConfig* config = &reactor->ctx->config;
+
+    uint64_t now = reactor->now_ms;
+    uint64_t due = UINT64_MAX;
+
+    if( config->idle_timeout_ms > 0 )
+        due = node->last_recv_ms + (uint64_t)config->idle_timeout_ms;
+
+    if( config->heartbeat_interval_ms > 0 )
+    {
+        // 이미 지났으면(방금 PING 을 보냄) 지금부터 한 간격 뒤
+        uint64_t ping_at = node->last_recv_ms + (uint64_t)config->heartbeat_interval_ms;
+        if( ping_at <= now )
+            ping_at = now + (uint64_t)config->heartbeat_interval_ms;
+
+        if( ping_at < due )
+            due = ping_at;
+    }
+
+    if( due == UINT64_MAX )
+        return;
+
+    TimerWheel_Schedule( reactor->timers, &node->idle_timer, now, ( due > now ) ? due - now : 0 );
+}
+
+/**
+ * ##   유휴 타이머 만료 (Reactor 루프의 TimerWheel_Advance 에서 호출)
+ * #### 수신마다 타이머를 옮기지 않으므로, 여기서 실제 유휴 시간을 보고 종료/HB_PING/재등록을 정한다.
+ */
+static void OnIdleTimer( void* arg )
+{
+    ClientNode*       node    = (ClientNode*)arg;
+    ServerReactor*    reactor = node->reactor;
+    TcpServerContext* ctx     = reactor->ctx;
+
+    // io_uring: 종료 진행 중 (남은 요청이 끝나면 CloseClient 가 정리)
+    if( node->closing )
+        return;
+
+    uint64_t idle = reactor->now_ms - node->last_recv_ms;
+
+    // 응답 없는 연결 정리 (Half-open 연결이 Broadcast 를 계속 받지 않도록)
+    if( ctx->config.idle_timeout_ms > 0 && idle >= (uint64_t)ctx->config.idle_timeout_ms )
+    {
+        if( ctx->io_backend == SERVER_IO_URING ) UringCloseClient( ctx, node );
+        else                                     CloseClient( ctx, node );
+        return;
+    }
+
+    // 조용한 연결에 생존 확인 (공유 프레임 참조, 쓰기 불가 시 일반 송신처럼 대기열로)
+    if( ctx->config.heartbeat_interval_ms > 0 && idle >= (uint64_t)ctx->config.heartbeat_interval_ms )
+    {
+        PacketFrame frame;
+        frame.iov[0].iov_base = ctx->heartbeat_frame->data;
+        frame.iov[0].iov_len  = (size_t)ctx->heartbeat_frame->len;
+        frame.iov_count       = 1;
+        frame.total_len       = ctx->heartbeat_frame->len;
+
+        WriteFrame( ctx, node, &frame, ctx->heartbeat_frame, NULL );
+    }
+
+    ScheduleIdleTimer( reactor, node );
+}
+
+/**
+ * ## 이벤트 대기 시간(ms)을 정한다. 할 일이 없으면 -1 (이벤트나 깨우기 신호가 올 때까지 무기한 대기)
+ * 읽기 재개는 워커가 eventfd 로 깨워주므로, 주기적 확인은 알림이 없는 작업이 남았을 때만 한다.
+ * exit_flag 는 세워도 깨우기 신호가 없으므로, Reactor 0 은 EXIT_FLAG_POLL_MS 마다 깨어나 확인한다.
+ */
+static int ReactorWaitTimeout( ServerReactor* reactor, volatile bool* exit_flag )
+{
+    // 이어 읽을 연결이 남아있다면 대기 없이 새 이벤트만 확인
+    if( reactor->read_pending_count > 0 )
+        return 0;
+
+    int timeout = -1;
+
+    if( reactor->index == 0 && exit_flag )
+        timeout = EXIT_FLAG_POLL_MS;
+
+    // 할당 실패로 멈춘 읽기 또는 유예 기간을 기다리는 노드
+    if( ( reactor->paused_head || Epoch_HasPending( reactor->ctx->client_epoch ) )
+        && ( timeout < 0 || REACTOR_RECHECK_MS < timeout ) )
+        timeout = REACTOR_RECHECK_MS;
+
+    uint64_t now = MonotonicMs();
+
+    // 가장 가까운 유휴 타이머 (없으면 -1)
+    int next_timer = TimerWheel_NextTimeout( reactor->timers, now );
+    if( next_timer >= 0 && ( timeout < 0 || next_timer < timeout ) )
+        timeout = next_timer;
+
+    // 사용자 타이머 (Reactor 0)
+    if( reactor->index == 0 )
+    {
+        pthread_mutex_lock( &reactor->ctx->timer_mutex );
+        next_timer = TimerWheel_NextTimeout( reactor->ctx->timer_wheel, now );
+        pthread_mutex_unlock( &reactor->ctx->timer_mutex );
+
+        if( next_timer >= 0 && ( timeout < 0 || next_timer < timeout ) )
+            timeout = next_timer;
+    }
+
+    return timeout;
+}
+
+/**
+ * ## Reactor 0 (Run 호출 스레드)이 루프를 탈출해야 하는지 확인한다.
+ */
+static bool StopRequested( ServerReactor* reactor, volatile bool* exit_flag )
+{
+    if( reactor->index != 0 )
+        return false;
+
+    return ( exit_flag && *exit_flag ) || reactor->ctx->stop_requested;
+}
+
+/**
+ * ## Epoll 이벤트 루프
+ * exit_flag/Stop 은 Reactor 0 (Run 호출 스레드)만 확인하며, 나머지는 reactor->is_running 으로 멈춘다.
+ * Stop 과 읽기 재개 알림은 wake_fd(eventfd)로 들어오므로 유휴 상태에서는 타임아웃 없이 대기한다. (exit_flag 제외)
+ */
+static void ReactorLoop( ServerReactor* reactor, volatile bool* exit_flag )
+{
+    TcpServerContext* ctx = reactor->ctx;
+
+    while( ctx->is_running && reactor->is_running )
+    {
+        // 외부 종료 플래그 체크
+        if( StopRequested( reactor, exit_flag ) )
+        {
+            printf( "[TcpServer] Stop signal detected. Exiting loop...\n" );
+            break;
+        }
+
+        int n_fds = epoll_wait( reactor->epoll_fd, reactor->events, MAX_EPOLL_EVENTS,
+                                ReactorWaitTimeout( reactor, exit_flag ) );
+
+        if( n_fds < 0 )
+        {
+            // 시그널 인터럽트는 무시
+            if( errno == EINTR ) continue;
+            break;
+        }
+
+        reactor->now_ms = MonotonicMs();
+
+        for( int i = 0; i < n_fds; ++i )
+        {
+            int curr_fd = reactor->events[i].data.fd;
+
+            // 깨우기 신호: 카운터만 비운다. (종료 확인과 읽기 재개는 루프에서 이어서 수행)
+            if( curr_fd == reactor->wake_fd )
+            {
+                uint64_t value;
+                ssize_t  ret = read( reactor->wake_fd, &value, sizeof( value ) );
+                (void)ret;
+                continue;
+            }
+
+            // [Case A] 새로운 클라이언트 접속
+            if( curr_fd == reactor->listen_fd )
+            {
+                AcceptClients( reactor );
+            }
+            // [Case B] 데이터 송수신 (From/To Client)
+            else
+            {
+                ClientNode* node = LookupClient( ctx, curr_fd );
+                if( !node )
+                    continue;
+
+                uint32_t revents = reactor->events[i].events;
+
+                // 소켓이 쓰기 가능해짐 -> 밀린 송신 데이터 전송 (수신 처리에서 닫힐 수 있으므로 먼저 수행)
+                if( revents & EPOLLOUT )
+                    FlushClient( ctx, node );
+
+                if( revents & ( EPOLLIN | EPOLLERR | EPOLLHUP ) )
+                    HandleReadResult( ctx, node, ReadClient( ctx, node ) );
+            }
+        }
+
+        // [Case C] 지난 루프에서 예산을 다 써서 미처 못 읽은 연결을 이어서 읽는다.
+        // 처리 중 다시 예산을 소진하면 새 리스트에 등록되므로 두 배열을 교대로 사용한다.
+        int  pending_count = reactor->read_pending_count;
+        int* pending_fds   = reactor->read_pending_fds;
+
+        reactor->read_pending_fds   = reactor->read_pending_swap;
+        reactor->read_pending_swap  = pending_fds;
+        reactor->read_pending_count = 0;
+
+        for( int i = 0; i < pending_count; ++i )
+        {
+            ClientNode* node = LookupClient( ctx, pending_fds[i] );
+
+            // 그 사이 이벤트로 모두 읽었거나 연결이 닫힌 경우
+            if( !node || !node->read_pending )
+                continue;
+
+            node->read_pending = false;
+            HandleReadResult( ctx, node, ReadClient( ctx, node ) );
+        }
+
+        // Case D: 워커 큐가 비워져 읽기를 재개할 수 있는 연결
+        ResumePausedReads( reactor );
+
+        // Case E: 만료된 유휴 타이머 (Heartbeat 전송, 유휴 연결 종료)와 사용자 타이머 (Reactor 0)
+        TimerWheel_Advance( reactor->timers, reactor->now_ms );
+        DispatchServerTimers( reactor );
+
+        // 유예 기간이 끝난 연결 노드 해제 (대기 중인 노드가 없으면 즉시 반환)
+        Epoch_Collect( ctx->client_epoch );
+    }
+}
+
+static bool InitUringReactor( ServerReactor* reactor );
+static void UringReactorLoop( ServerReactor* reactor, volatile bool* exit_flag );
+
+/**
+ * ## 선택된 백엔드의 이벤트 루프를 실행한다.
+ */
+static void RunReactor( ServerReactor* reactor, volatile bool* exit_flag )
+{
+    if( reactor->ctx->io_backend == SERVER_IO_URING )
+        UringReactorLoop( reactor, exit_flag );
+    else
+        ReactorLoop( reactor, exit_flag );
+}
+
+static void* ReactorThreadFunc( void* arg )
+{
+    RunReactor( (ServerReactor*)arg, NULL );
+    return NULL;
+}
+
+
+// --------------------------------------------------------------------------
+// 10. IO 스레드 (io_uring Reactor)
+//    SERVER_IO_URING 선택 시 사용된다. liburing 없이 시스템 콜과 mmap으로 링을 직접 다룬다.
+//    - accept  : Multishot Accept 1회 제출로 연결마다 CQE 수신
+//    - recv    : Multishot Recv + Provided Buffer Ring (커널이 버퍼를 골라 채움, 연결별 버퍼 불필요)
+//    - send    : Sender의 직접 전송 후 남은 송신 큐 세그먼트를 SEND 요청으로 제출 (Sender는 eventfd로 깨우기만 함)
+// --------------------------------------------------------------------------
+
+#if TCPC_HAVE_IO_URING
+
+#define URING_QUEUE_DEPTH 1024 // SQ 크기 (CQ는 4배)
+#define URING_BUF_COUNT   1024 // Provided Buffer 개수 (2의 거듭제곱)
+#define URING_BUF_GROUP   0    // Provided Buffer 그룹 ID
+
+// user_data 상위 32비트: 요청 종류, 하위 32비트: FD
+enum
+{
+    URING_OP_ACCEPT = 1,
+    URING_OP_RECV,
+    URING_OP_SEND,
+    URING_OP_WAKE,
+    URING_OP_CANCEL
+};
+
+/**
+ * ## io_uring 인스턴스와 mmap된 SQ/CQ, Provided Buffer Ring
+ */
+typedef struct UringQueue
+{
+    int ring_fd;
+
+    // mmap 영역 (IORING_FEAT_SINGLE_MMAP: SQ/CQ 링 공유)
+    void*  ring_ptr;
+    size_t ring_size;
+
+    struct io_uring_sqe* sqes;
+    size_t               sqes_size;
+
+    // SQ
+    unsigned* sq_head;
+    unsigned* sq_tail;
+    unsigned* sq_array;
+    unsigned  sq_mask;
+    unsigned  sq_entries;
+    unsigned  sq_local_tail; // 아직 커널에 알리지 않은 tail
+    unsigned  to_submit;
+
+    // CQ
+    unsigned*            cq_head;
+    unsigned*            cq_tail;
+    unsigned             cq_mask;
+    struct io_uring_cqe* cqes;
+
+    // Provided Buffer Ring
+    struct io_uring_buf_ring* buf_ring;
+    size_t                    buf_ring_size;
+    char*                     buf_pool; // URING_BUF_COUNT * DEFAULT_BUF_SIZE
+    unsigned short            buf_tail;
+
+    bool accept_multishot; // 리스너에 Multishot Accept가 걸려있는지
+} UringQueue;
+
+static int SysUringSetup( unsigned entries, struct io_uring_params* p )
+{
+    return (int)syscall( __NR_io_uring_setup, entries, p );
+}
+
+static int SysUringEnter( int fd, unsigned to_submit, unsigned min_complete, unsigned flags, void* arg, size_t argsz )
+{
+    return (int)syscall( __NR_io_uring_enter, fd, to_submit, min_complete, flags, arg, argsz );
+}
+
+static int SysUringRegister( int fd, unsigned opcode, void* arg, unsigned nr_args )
+{
+    return (int)syscall( __NR_io_uring_register, fd, opcode, arg, nr_args );
+}
+
+static inline uint64_t UringData( int op, int fd )
+{
+    return ( (uint64_t)op << 32 ) | (uint32_t)fd;
+}
+
+/**
+ * ## 쌓인 SQE를 커널에 제출하고, wait가 true면 CQE가 1개 이상 올 때까지 최대 timeout_ms 대기한다. (음수: 무기한)
+ */
+static void UringSubmit( UringQueue* q, bool wait, int timeout_ms )
+{
+    // tail 공개 (커널이 SQE 내용을 읽기 전에 기록이 끝나 있어야 함)
+    __atomic_store_n( q->sq_tail, q->sq_local_tail, __ATOMIC_RELEASE );
+
+    if( !wait && q->to_submit == 0 )
+        return;
+
+    struct __kernel_timespec        ts  = { timeout_ms / 1000, ( timeout_ms % 1000 ) * 1000 * 1000L };
+    struct io_uring_getevents_arg   arg;
+    memset( &arg, 0, sizeof( arg ) );
+    if( timeout_ms >= 0 )
+        arg.ts = (uint64_t)(uintptr_t)&ts; // 0 이면 타임아웃 없음
+
+    unsigned flags = IORING_ENTER_EXT_ARG | ( wait ? IORING_ENTER_GETEVENTS : 0 );
+
+    int ret = SysUringEnter( q->ring_fd, q->to_submit, wait ? 1 : 0, flags, &arg, sizeof( arg ) );
+
+    // ETIME(타임아웃), EINTR은 정상. 제출 개수는 성공 시 반환값만큼 줄어든다.
+    if( ret > 0 )
+        q->to_submit -= ( (unsigned)ret > q->to_submit ) ? q->to_submit : (unsigned)ret;
+}
+
+/**
+ * ## 비어있는 SQE를 하나 얻는다. SQ가 가득 찼으면 먼저 제출한다.
+ */
+static struct io_uring_sqe* UringGetSqe( UringQueue* q )
+{
+    unsigned head = __atomic_load_n( q->sq_head, __ATOMIC_ACQUIRE );
+
+    if( q->sq_local_tail - head >= q->sq_entries )
+    {
+        UringSubmit( q, false, 0 );
+        head = __atomic_load_n( q->sq_head, __ATOMIC_ACQUIRE );
+        if( q->sq_local_tail - head >= q->sq_entries )
+            return NULL;
+    }
+
+    unsigned idx = q->sq_local_tail & q->sq_mask;
+    struct io_uring_sqe* sqe = &q->sqes[idx];
+
+    memset( sqe, 0, sizeof( *sqe ) );
+    q->sq_array[idx] = idx;
+    q->sq_local_tail++;
+    q->to_submit++;
+
+    return sqe;
+}
+
+/**
+ * ## 다 쓴 Provided Buffer를 링에 돌려준다.
+ */
+static void UringRecycleBuffer( UringQueue* q, unsigned short bid )
+{
+    struct io_uring_buf* buf = &q->buf_ring->bufs[q->buf_tail & ( URING_BUF_COUNT - 1 )];
+
+    buf->addr = (uint64_t)(uintptr_t)( q->buf_pool + (size_t)bid * DEFAULT_BUF_SIZE );
+    buf->len  = DEFAULT_BUF_SIZE;
+    buf->bid  = bid;
+
+    q->buf_tail++;
+    __atomic_store_n( &q->buf_ring->tail, q->buf_tail, __ATOMIC_RELEASE );
+}
+
+static bool UringPrepAccept( UringQueue* q, int listen_fd )
+{
+    struct io_uring_sqe* sqe = UringGetSqe( q );
+    if( !sqe )
+        return false;
+
+    sqe->opcode       = IORING_OP_ACCEPT;
+    sqe->fd           = listen_fd;
+    sqe->ioprio       = IORING_ACCEPT_MULTISHOT;
+    sqe->accept_flags = SOCK_NONBLOCK | SOCK_CLOEXEC;
+    sqe->user_data    = UringData( URING_OP_ACCEPT, listen_fd );
+
+    q->accept_multishot = true;
+    return true;
+}
+
+static bool UringPrepRecv( UringQueue* q, ClientNode* node )
+{
+    struct io_uring_sqe* sqe = UringGetSqe( q );
+    if( !sqe )
+        return false;
+
+    sqe->opcode    = IORING_OP_RECV;
+    sqe->fd        = node->fd;
+    sqe->ioprio    = IORING_RECV_MULTISHOT;
+    sqe->flags     = IOSQE_BUFFER_SELECT;
+    sqe->buf_group = URING_BUF_GROUP;
+    sqe->user_data = UringData( URING_OP_RECV, node->fd );
+
+    node->uring_inflight++;
+    node->uring_recv_armed = true;
+    return true;
+}
+
+/**
+ * ##   걸려있는 Multishot Recv 를 취소한다. (읽기 중단 시)
+ * #### 취소가 처리되기 전까지 도착한 데이터는 보류 버퍼에 쌓이고, 이후에는 커널 버퍼에 남아 TCP 흐름 제어가 동작한다.
+ */
+static void UringPrepCancelRecv( UringQueue* q, ClientNode* node )
+{
+    struct io_uring_sqe* sqe = UringGetSqe( q );
+    if( !sqe )
+        return; // 제출 불가: 취소하지 못한 만큼 보류 버퍼가 더 쌓일 뿐 데이터는 잃지 않음
+
+    sqe->opcode    = IORING_OP_ASYNC_CANCEL;
+    sqe->fd        = -1;
+    sqe->addr      = UringData( URING_OP_RECV, node->fd );
+    sqe->user_data = UringData( URING_OP_CANCEL, node->fd );
+}
+
+static bool UringPrepWake( UringQueue* q, ServerReactor* reactor )
+{
+    struct io_uring_sqe* sqe = UringGetSqe( q );
+    if( !sqe )
+        return false;
+
+    sqe->opcode    = IORING_OP_READ;
+    sqe->fd        = reactor->wake_fd;
+    sqe->addr      = (uint64_t)(uintptr_t)&reactor->wake_value;
+    sqe->len       = sizeof( reactor->wake_value );
+    sqe->user_data = UringData( URING_OP_WAKE, reactor->wake_fd );
+
+    return true;
+}
+
+/**
+ * ## 송신 큐의 첫 세그먼트를 SEND 요청으로 제출한다. (Reactor 전용, out_mutex 보유)
+ * 요청이 끝날 때까지 첫 세그먼트는 커널이 읽으므로 Sender는 tail 쪽에만 덧붙인다.
+ */
+static void UringPrepSend( ServerReactor* reactor, ClientNode* node )
+{
+    OutSegment* seg = node->out_head;
+
+    struct io_uring_sqe* sqe = UringGetSqe( reactor->uring );
+    if( !sqe )
+    {
+        // 제출 불가: 다음 루프에서 다시 시도하도록 요청 목록에 남긴다. (out_armed 유지)
+        pthread_mutex_lock( &reactor->flush_mutex );
+        reactor->flush_fds[reactor->flush_count++] = node->fd;
+        pthread_mutex_unlock( &reactor->flush_mutex );
+        return;
+    }
+
+    sqe->opcode    = IORING_OP_SEND;
+    sqe->fd        = node->fd;
+    sqe->addr      = (uint64_t)(uintptr_t)( seg->buf->data + seg->offset );
+    sqe->len       = (unsigned)( seg->buf->len - seg->offset );
+    sqe->msg_flags = MSG_NOSIGNAL;
+    sqe->user_data = UringData( URING_OP_SEND, node->fd );
+
+    node->uring_send_inflight = true;
+    node->uring_inflight++;
+}
+
+/**
+ * ## 송신 큐에 남은 데이터의 전송을 Reactor에 요청한다. (Sender 스레드, out_mutex 보유)
+ * 이미 요청했거나 전송 중이면 완료 처리에서 이어 보내므로 아무것도 하지 않는다.
+ */
+static void UringArmWrite( ClientNode* node )
+{
+    if( node->out_armed )
+        return;
+
+    ServerReactor* reactor = node->reactor;
+    bool           notify;
+
+    node->out_armed = true;
+
+    pthread_mutex_lock( &reactor->flush_mutex );
+    notify = ( reactor->flush_count == 0 );
+    reactor->flush_fds[reactor->flush_count++] = node->fd;
+    pthread_mutex_unlock( &reactor->flush_mutex );
+
+    // 요청 목록이 비어있을 때만 깨운다. (이미 깨어날 예정이면 시스템 콜 생략)
+    if( notify )
+        WakeReactor( reactor );
+}
+
+/**
+ * ## 종료를 시작한다. 제출된 요청이 모두 끝나야 노드를 해제할 수 있다. (Reactor 전용)
+ * shutdown()으로 진행 중인 recv/send 를 즉시 완료시킨다.
+ */
+static void UringCloseClient( TcpServerContext* ctx, ClientNode* node )
+{
+    if( !node->closing )
+    {
+        pthread_mutex_lock( &node->out_mutex );
+        node->closing = true;
+        node->closed  = true;
+
+        // 남은 송신 데이터는 의미 없음 (전송 중인 세그먼트는 커널이 읽고 있으므로 완료 후 정리)
+        if( !node->uring_send_inflight )
+            DropOutbound( node );
+        pthread_mutex_unlock( &node->out_mutex );
+
+        shutdown( node->fd, SHUT_RDWR );
+    }
+
+    if( node->uring_inflight == 0 )
+        CloseClient( ctx, node );
+}
+
+/**
+ * ## 요청 완료 후 참조 카운트를 내리고, 종료 중이었다면 정리를 마친다.
+ */
+static void UringReleaseRef( TcpServerContext* ctx, ClientNode* node )
+{
+    node->uring_inflight--;
+
+    if( node->closing && node->uring_inflight == 0 )
+        CloseClient( ctx, node );
+}
+
+/**
+ * ## Reactor 소유 연결을 FD로 찾는다. (다른 Reactor가 재사용한 FD는 무시)
+ */
+static ClientNode* UringFindClient( ServerReactor* reactor, int fd )
+{
+    TcpServerContext* ctx = reactor->ctx;
+
+    // 다른 Reactor의 노드는 언제든 해제될 수 있으므로 소유자 확인까지는 읽기 구간 안에서 한다.
+    int         guard = Epoch_Enter( ctx->client_epoch );
+    ClientNode* node  = LookupClient( ctx, fd );
+    bool        owned = ( node && node->reactor == reactor );
+    Epoch_Exit( ctx->client_epoch, guard );
+
+    return owned ? node : NULL;
+}
+
+static void UringHandleAccept( ServerReactor* reactor, struct io_uring_cqe* cqe )
+{
+    TcpServerContext* ctx = reactor->ctx;
+    UringQueue*       q   = reactor->uring;
+
+    if( !( cqe->flags & IORING_CQE_F_MORE ) )
+        q->accept_multishot = false; // 루프 끝에서 다시 건다.
+
+    if( cqe->res < 0 )
+        return;
+
+    int client_fd = cqe->res;
+
+    // 세션 생성 실패 (FD 한도 초과, 메모리 부족) 시 즉시 거절
+    ClientNode* node = AddClient( ctx, reactor, client_fd );
+    if( !node )
+    {
+        close( client_fd );
+        return;
+    }
+
+    if( !UringPrepRecv( q, node ) )
+    {
+        CloseClient( ctx, node );
+        return;
+    }
+
+    // 핸드셰이크 전송 (Non-blocking, 나머지는 SEND 요청으로)
+    StartHandshake( ctx, node );
+}
+
+/**
+ * ## 수신 데이터를 보류 버퍼 뒤에 붙인다. (읽기 중단 중, 메모리 부족 시 false)
+ */
+static bool UringHoldData( ClientNode* node, const char* data, int len )
+{
+    if( node->hold_len + len > node->hold_cap )
+    {
+        int   cap  = ( node->hold_cap > 0 ) ? node->hold_cap : DEFAULT_BUF_SIZE;
+        while( cap < node->hold_len + len )
+            cap *= 2;
+
+        char* grown = (char*)realloc( node->hold_buf, cap );
+        if( !grown )
+            return false;
+
+        node->hold_buf = grown;
+        node->hold_cap = cap;
+    }
+
+    memcpy( node->hold_buf + node->hold_len, data, len );
+    node->hold_len += len;
+    return true;
+}
+
+/**
+ * ## 연결의 읽기를 멈추고 Multishot Recv 를 취소한다.
+ */
+static void UringPauseReads( ServerReactor* reactor, ClientNode* node )
+{
+    if( PauseReads( reactor->ctx, node ) && node->uring_recv_armed )
+        UringPrepCancelRecv( reactor->uring, node );
+}
+
+/**
+ * ##   수신 데이터를 수신 버퍼에 이어 붙이며 완성된 프레임을 워커로 보낸다. (Reactor 전용)
+ * #### 읽기가 멈춰 있거나 도중에 멈추게 되면 나머지는 보류 버퍼에 순서대로 쌓아두고 재개 시 이어 처리한다.
+ *
+ * Return: false(프레임 길이 오류 또는 메모리 부족 -> 연결 종료 필요)
+ */
+static bool UringFeed( ServerReactor* reactor, ClientNode* node, const char* data, int len )
+{
+    TcpServerContext* ctx    = reactor->ctx;
+    ServerWorker*     worker = WorkerOf( ctx, node );
+
+    while( len > 0 && !node->closing )
+    {
+        if( node->read_paused || __atomic_load_n( &worker->read_paused, __ATOMIC_ACQUIRE ) )
+        {
+            UringPauseReads( reactor, node );
+            return UringHoldData( node, data, len );
+        }
+
+        int space = DEFAULT_BUF_SIZE - node->recv_len;
+        int n     = ( len < space ) ? len : space;
+
+        memcpy( node->recv_buf + node->recv_len, data, n );
+        node->recv_len += n;
+        data           += n;
+        len            -= n;
+
+        DispatchResult dispatched = DispatchFrames( ctx, node );
+
+        if( dispatched == DISPATCH_ERROR )
+            return false;
+        if( dispatched == DISPATCH_STALLED )
+            UringPauseReads( reactor, node ); // 나머지는 다음 반복에서 보류 버퍼로
+    }
+
+    return true;
+}
+
+static void UringHandleRecv( ServerReactor* reactor, ClientNode* node, struct io_uring_cqe* cqe )
+{
+    TcpServerContext* ctx  = reactor->ctx;
+    UringQueue*       q    = reactor->uring;
+    bool              more = ( cqe->flags & IORING_CQE_F_MORE ) != 0;
+    bool              ok   = true;
+
+    if( cqe->res > 0 && ( cqe->flags & IORING_CQE_F_BUFFER ) )
+    {
+        unsigned short bid  = (unsigned short)( cqe->flags >> IORING_CQE_BUFFER_SHIFT );
+        const char*    data = q->buf_pool + (size_t)bid * DEFAULT_BUF_SIZE;
+
+        node->last_recv_ms = reactor->now_ms;
+        Metrics_Add( ctx->metrics, METRIC_BYTES_IN, (uint64_t)cqe->res );
+
+        ok = UringFeed( reactor, node, data, cqe->res );
+
+        UringRecycleBuffer( q, bid );
+    }
+    else if( cqe->res == 0 && node->read_paused )
+    {
+        node->uring_eof = true; // 보류 데이터를 모두 전달한 뒤 재개 시점에 닫는다.
+    }
+    else if( cqe->res != -ENOBUFS && cqe->res != -ECANCELED )
+    {
+        ok = false; // 0: 상대방 정상 종료, 그 외 음수: 에러 (ECANCELED: 읽기 중단으로 취소됨)
+    }
+
+    if( more )
+    {
+        if( !ok )
+            UringCloseClient( ctx, node );
+        return;
+    }
+
+    // Multishot 이 끝났음 (버퍼 고갈, 취소 등): 참조를 내리고 살아있으면 다시 건다. (읽기 중단 중이면 재개 시)
+    node->uring_inflight--;
+    node->uring_recv_armed = false;
+
+    if( !ok || node->closing )
+        UringCloseClient( ctx, node );
+    else if( !node->read_paused && !UringPrepRecv( q, node ) )
+        UringCloseClient( ctx, node );
+}
+
+/**
+ * ##   읽기를 재개한다. 수신 버퍼와 보류 버퍼에 남은 데이터를 먼저 전달한 뒤 Recv 를 다시 건다. (Reactor 전용)
+ * #### 도중에 다시 멈추면 남은 데이터는 보류 버퍼에 남는다.
+ */
+static void UringResumeReads( ServerReactor* reactor, ClientNode* node )
+{
+    TcpServerContext* ctx = reactor->ctx;
+
+    // 1. 수신 버퍼에 남은 프레임
+    DispatchResult dispatched = DispatchFrames( ctx, node );
+
+    if( dispatched == DISPATCH_ERROR )
+    {
+        UringCloseClient( ctx, node );
+        return;
+    }
+
+    if( dispatched == DISPATCH_STALLED )
+    {
+        UringPauseReads( reactor, node );
+        return;
+    }
+
+    // 2. 보류 데이터 (다시 멈추면 UringFeed 가 새 보류 버퍼에 나머지를 옮긴다)
+    if( node->hold_len > 0 )
+    {
+        char* held     = node->hold_buf;
+        int   held_len = node->hold_len;
+
+        node->hold_buf = NULL;
+        node->hold_len = 0;
+        node->hold_cap = 0;
+
+        bool ok = UringFeed( reactor, node, held, held_len );
+        free( held );
+
+        if( !ok )
+        {
+            UringCloseClient( ctx, node );
+            return;
+        }
+    }
+
+    if( node->read_paused )
+        return;
+
+    // 3. 중단 중 상대방이 닫았다면 이제 닫고, 아니면 Recv 를 다시 건다. (취소가 아직 진행 중이면 완료 시 다시 걸림)
+    if( node->uring_eof )
+        UringCloseClient( ctx, node );
+    else if( !node->uring_recv_armed && !UringPrepRecv( reactor->uring, node ) )
+        UringCloseClient( ctx, node );
+}
+
+static void UringHandleSend( ServerReactor* reactor, ClientNode* node, struct io_uring_cqe* cqe )
+{
+    TcpServerContext* ctx    = reactor->ctx;
+    bool              failed = false;
+
+    pthread_mutex_lock( &node->out_mutex );
+    {
+        node->uring_send_inflight = false;
+
+        if( cqe->res > 0 )
+            Metrics_Add( ctx->metrics, METRIC_BYTES_OUT, (uint64_t)cqe->res );
+
+        if( cqe->res > 0 && !node->closing )
+        {
+            // 첫 세그먼트만 제출했으므로 그보다 적게 보냈으면 부분 전송
+            if( node->out_head && cqe->res < node->out_head->buf->len - node->out_head->offset )
+                Metrics_Add( ctx->metrics, METRIC_PARTIAL_WRITES, 1 );
+
+            ConsumeOutbound( node, cqe->res );
+        }
+        else if( node->closing || ( cqe->res != -EINTR && cqe->res != -EAGAIN ) )
+        {
+            // 연결 끊김: 남은 데이터는 의미가 없으므로 버린다.
+            DropOutbound( node );
+            failed = ( cqe->res < 0 );
+        }
+
+        if( node->out_len > 0 && !node->closing )
+        {
+            UringPrepSend( reactor, node );
+        }
+        else
+        {
+            node->out_armed = false;
+        }
+    }
+    pthread_mutex_unlock( &node->out_mutex );
+
+    if( failed )
+        UringCloseClient( ctx, node );
+
+    UringReleaseRef( ctx, node );
+}
+
+/**
+ * ## Sender가 요청한 연결들의 송신 큐 전송을 시작한다.
+ */
+static void UringProcessFlushRequests( ServerReactor* reactor )
+{
+    pthread_mutex_lock( &reactor->flush_mutex );
+
+    int  count = reactor->flush_count;
+    int* fds   = reactor->flush_fds;
+
+    reactor->flush_fds   = reactor->flush_swap;
+    reactor->flush_swap  = fds;
+    reactor->flush_count = 0;
+
+    pthread_mutex_unlock( &reactor->flush_mutex );
+
+    for( int i = 0; i < count; ++i )
+    {
+        ClientNode* node = UringFindClient( reactor, fds[i] );
+        if( !node )
+            continue;
+
+        pthread_mutex_lock( &node->out_mutex );
+        {
+            if( node->uring_send_inflight )
+            {
+                // 진행 중인 요청이 완료되면 이어 보낸다.
+            }
+            else if( node->out_len > 0 && !node->closing )
+            {
+                UringPrepSend( reactor, node );
+            }
+            else
+            {
+                node->out_armed = false;
+            }
+        }
+        pthread_mutex_unlock( &node->out_mutex );
+    }
+}
+
+/**
+ * ## Reactor의 io_uring 인스턴스와 Provided Buffer Ring을 생성한다.
+ * 커널이 필요한 기능(EXT_ARG, SINGLE_MMAP, PBUF_RING)을 지원하지 않으면 false를 반환한다.
+ */
+static bool InitUringReactor( ServerReactor* reactor )
+{
+    UringQueue* q = (UringQueue*)calloc( 1, sizeof( UringQueue ) );
+    if( !q )
+        return false;
+
+    q->ring_fd       = -1;
+    q->ring_ptr      = MAP_FAILED;
+    q->sqes          = MAP_FAILED;
+    q->buf_ring      = MAP_FAILED;
+    reactor->uring   = q;
+    reactor->wake_fd = -1;
+
+    pthread_mutex_init( &reactor->flush_mutex, NULL );
+
+    // 1. io_uring 생성
+    struct io_uring_params p;
+    memset( &p, 0, sizeof( p ) );
+    p.flags      = IORING_SETUP_CQSIZE;
+    p.cq_entries = URING_QUEUE_DEPTH * 4; // Multishot은 요청 하나에 CQE가 여럿
+
+    q->ring_fd = SysUringSetup( URING_QUEUE_DEPTH, &p );
+    if( q->ring_fd < 0 )
+        return false;
+
+    if( !( p.features & IORING_FEAT_SINGLE_MMAP ) || !( p.features & IORING_FEAT_EXT_ARG ) )
+        return false;
+
+    // 2. SQ/CQ 링 매핑
+    size_t sq_size = p.sq_off.array + p.sq_entries * sizeof( unsigned );
+    size_t cq_size = p.cq_off.cqes  + p.cq_entries * sizeof( struct io_uring_cqe );
+
+    q->ring_size = ( sq_size > cq_size ) ? sq_size : cq_size;
+    q->ring_ptr  = mmap( NULL, q->ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                         q->ring_fd, IORING_OFF_SQ_RING );
+    if( q->ring_ptr == MAP_FAILED )
+        return false;
+
+    q->sqes_size = p.sq_entries * sizeof( struct io_uring_sqe );
+    q->sqes      = mmap( NULL, q->sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                         q->ring_fd, IORING_OFF_SQES );
+    if( q->sqes == MAP_FAILED )
+        return false;
+
+    char* base = (char*)q->ring_ptr;
+
+    q->sq_head       = (unsigned*)( base + p.sq_off.head );
+    q->sq_tail       = (unsigned*)( base + p.sq_off.tail );
+    q->sq_array      = (unsigned*)( base + p.sq_off.array );
+    q->sq_mask       = *(unsigned*)( base + p.sq_off.ring_mask );
+    q->sq_entries    = p.sq_entries;
+    q->sq_local_tail = *q->sq_tail;
+
+    q->cq_head = (unsigned*)( base + p.cq_off.head );
+    q->cq_tail = (unsigned*)( base + p.cq_off.tail );
+    q->cq_mask = *(unsigned*)( base + p.cq_off.ring_mask );
+    q->cqes    = (struct io_uring_cqe*)( base + p.cq_off.cqes );
+
+    // 3. Provided Buffer Ring 등록 (커널 5.19+)
+    q->buf_ring_size = URING_BUF_COUNT * sizeof( struct io_uring_buf );
+    q->buf_ring      = mmap( NULL, q->buf_ring_size, PROT_READ | PROT_WRITE,
+                             MAP_PRIVATE | MAP_ANONYMOUS, -1, 0 );
+    if( q->buf_ring == MAP_FAILED )
+        return false;
+
+    q->buf_pool = (char*)malloc( (size_t)URING_BUF_COUNT * DEFAULT_BUF_SIZE );
+    if( !q->buf_pool )
+        return false;
+
+    struct io_uring_buf_reg reg;
+    memset( &reg, 0, sizeof( reg ) );
+    reg.ring_addr    = (uint64_t)(uintptr_t)q->buf_ring;
+    reg.ring_entries = URING_BUF_COUNT;
+    reg.bgid         = URING_BUF_GROUP;
+
+    if( SysUringRegister( q->ring_fd, IORING_REGISTER_PBUF_RING, &reg, 1 ) < 0 )
+        return false;
+
+    for( int i = 0; i < URING_BUF_COUNT; ++i )
+        UringRecycleBuffer( q, (unsigned short)i );
+
+    // 4. 깨우기용 eventfd 와 송신 요청 목록 (연결당 최대 1회 등록)
+    reactor->wake_fd = eventfd( 0, EFD_CLOEXEC );
+    if( reactor->wake_fd < 0 )
+        return false;
+
+    reactor->flush_capacity = reactor->ctx->client_table_size;
+    reactor->flush_fds      = (int*)malloc( sizeof( int ) * reactor->flush_capacity );
+    reactor->flush_swap     = (int*)malloc( sizeof( int ) * reactor->flush_capacity );
+
+    return reactor->flush_fds && reactor->flush_swap;
+}
+
+/**
+ * ## io_uring 자원을 해제한다. (초기화 도중 실패한 경우도 처리)
+ * 링을 닫으면 커널이 남은 요청을 모두 취소한다.
+ */
+static void DestroyUringReactor( ServerReactor* reactor )
+{
+    UringQueue* q = reactor->uring;
+    if( !q )
+        return;
+
+    if( q->ring_fd >= 0 )              close( q->ring_fd );
+    if( q->sqes     != MAP_FAILED )    munmap( q->sqes, q->sqes_size );
+    if( q->ring_ptr != MAP_FAILED )    munmap( q->ring_ptr, q->ring_size );
+    if( q->buf_ring != MAP_FAILED )    munmap( q->buf_ring, q->buf_ring_size );
+    free( q->buf_pool );
+    free( q );
+
+    if( reactor->wake_fd >= 0 )
+        close( reactor->wake_fd );
+
+    free( reactor->flush_fds );
+    free( reactor->flush_swap );
+    pthread_mutex_destroy( &reactor->flush_mutex );
+
+    reactor->uring      = NULL;
+    reactor->wake_fd    = -1;
+    reactor->flush_fds  = NULL;
+    reactor->flush_swap = NULL;
+}
+
+/**
+ * ## io_uring 이벤트 루프
+ * 완료 큐(CQE)를 처리하며 새 요청을 쌓고, 루프마다 한 번의 io_uring_enter로 제출과 대기를 함께 한다.
+ */
+static void UringReactorLoop( ServerReactor* reactor, volatile bool* exit_flag )
+{
+    TcpServerContext* ctx = reactor->ctx;
+    UringQueue*       q   = reactor->uring;
+
+    UringPrepAccept( q, reactor->listen_fd );
+    UringPrepWake( q, reactor );
+
+    while( ctx->is_running && reactor->is_running )
+    {
+        // 외부 종료 플래그 체크
+        if( StopRequested( reactor, exit_flag ) )
+        {
+            printf( "[TcpServer] Stop signal detected. Exiting loop...\n" );
+            break;
+        }
+
+        // 제출 + 대기 (종료 요청, 송신 요청, 읽기 재개는 wake_fd 의 READ 완료로 깨어남)
+        UringSubmit( q, true, ReactorWaitTimeout( reactor, exit_flag ) );
+
+        reactor->now_ms = MonotonicMs();
+
+        unsigned head = *q->cq_head;
+        unsigned tail = __atomic_load_n( q->cq_tail, __ATOMIC_ACQUIRE );
+
+        for( ; head != tail; ++head )
+        {
+            struct io_uring_cqe* cqe = &q->cqes[head & q->cq_mask];
+
+            int op = (int)( cqe->user_data >> 32 );
+            int fd = (int)( cqe->user_data & 0xffffffffu );
+
+            if( op == URING_OP_ACCEPT )
+            {
+                UringHandleAccept( reactor, cqe );
+            }
+            else if( op == URING_OP_WAKE )
+            {
+                UringPrepWake( q, reactor );
+            }
+            else
+            {
+                // 노드는 제출된 요청이 남아있는 동안 해제되지 않는다.
+                ClientNode* node = LookupClient( ctx, fd );
+
+                if( !node )
+                {
+                    // 노드 없이 완료된 수신은 버퍼만 반납
+                    if( cqe->flags & IORING_CQE_F_BUFFER )
+                        UringRecycleBuffer( q, (unsigned short)( cqe->flags >> IORING_CQE_BUFFER_SHIFT ) );
+                }
+                else if( op == URING_OP_RECV )
+                {
+                    UringHandleRecv( reactor, node, cqe );
+                }
+                else if( op == URING_OP_SEND )
+                {
+                    UringHandleSend( reactor, node, cqe );
+                }
+            }
+        }
+
+        __atomic_store_n( q->cq_head, head, __ATOMIC_RELEASE );
+
+        // Multishot Accept가 끊겼으면 (에러 등) 다시 건다.
+        if( !q->accept_multishot )
+            UringPrepAccept( q, reactor->listen_fd );
+
+        // Sender가 요청한 송신 시작
+        UringProcessFlushRequests( reactor );
+
+        // 워커 큐가 비워져 읽기를 재개할 수 있는 연결
+        ResumePausedReads( reactor );
+
+        // 만료된 유휴 타이머 (Heartbeat 전송, 유휴 연결 종료)와 사용자 타이머 (Reactor 0)
+        TimerWheel_Advance( reactor->timers, reactor->now_ms );
+        DispatchServerTimers( reactor );
+
+        // 유예 기간이 끝난 연결 노드 해제 (대기 중인 노드가 없으면 즉시 반환)
+        Epoch_Collect( ctx->client_epoch );
+    }
+}
+
+#else // !TCPC_HAVE_IO_URING
+
+// 커널 헤더가 io_uring을 지원하지 않는 환경: Init에서 항상 epoll로 대체된다.
+static bool InitUringReactor( ServerReactor* reactor ) { (void)reactor; return false; }
+static void DestroyUringReactor( ServerReactor* reactor ) { (void)reactor; }
+static void UringReactorLoop( ServerReactor* reactor, volatile bool* exit_flag ) { ReactorLoop( reactor, exit_flag ); }
+
+static void UringArmWrite( ClientNode* node ) { (void)node; }
+static void UringCloseClient( TcpServerContext* ctx, ClientNode* node ) { CloseClient( ctx, node ); }
+static void UringResumeReads( ServerReactor* reactor, ClientNode* node ) { (void)reactor; (void)node; }
+
+#endif // TCPC_HAVE_IO_URING
+
+
+// --------------------------------------------------------------------------
+// 11. 멤버 함수 구현
+// --------------------------------------------------------------------------
+
+static bool impl_Server_Init( TcpServerContext* ctx, int port )
+{
+    if( !ctx )
+        return false;
+
+    // 모든 연결이 공유할 핸드셰이크 프레임
+    if( !ctx->handshake_frame )
+        ctx->handshake_frame = CreateHandshakeFrame();
+    if( !ctx->handshake_frame )
+        return false;
+
+    // 모든 연결이 공유할 HB_PING 프레임
+    if( !ctx->heartbeat_frame )
+        ctx->heartbeat_frame = CreateHeartbeatFrame();
+    if( !ctx->heartbeat_frame )
+        return false;
+
+    // Reactor별 리스너 + IO 백엔드 생성 (실패 시 정리는 Destroy에서 수행)
+    for( int i = 0; i < ctx->reactor_count; ++i )
+    {
+        ServerReactor* reactor = &ctx->reactors[i];
+
+        if( !OpenListener( reactor, port ) )
+            return false;
+
+        // 유휴 타이머 휠 (IO 백엔드와 무관)
+        reactor->now_ms = MonotonicMs();
+        if( !reactor->timers )
+            reactor->timers = TimerWheel_Create( TIMER_WHEEL_TICK_MS, reactor->now_ms );
+        if( !reactor->timers )
+            return false;
+
+        if( ctx->io_backend == SERVER_IO_URING )
+        {
+            if( InitUringReactor( reactor ) )
+                continue;
+
+            // 첫 Reactor에서 실패하면 (커널 미지원, seccomp 차단 등) 서버 전체를 epoll로 대체한다.
+            if( i != 0 )
+                return false;
+
+            printf( "[TcpServer] io_uring unavailable. Falling back to epoll.\n" );
+            DestroyUringReactor( reactor );
+            ctx->io_backend = SERVER_IO_EPOLL;
+        }
+
+        if( !InitEpollReactor( reactor ) )
+            return false;
+    }
+
+    printf( "[TcpServer] Initialized on port %d (Reactors: %d)\n", port, ctx->reactor_count );
+    return true;
+}
 
-    addr.sin_family      = AF_INET;
-    addr.sin_addr.s_addr = INADDR_ANY;
-    addr.sin_port        = htons( port );
+static void impl_Server_Run( TcpServerContext* ctx, volatile bool* exit_flag )
+{
+    if( !ctx )
+        return;
 
-    if( bind( ctx->listen_fd, (struct sockaddr*)&addr, sizeof( addr ) ) < 0 )
+    ctx->is_running     = true;
+    ctx->stop_requested = false;
+
+    // 서버가 만드는 스레드는 종료 시그널을 막아둔다. (사용자 시그널 핸들러는 Run 호출 스레드에서 실행됨)
+    // 핸들러에서의 종료는 Stop 으로 한다. eventfd 쓰기로 깨우므로 확인과 대기 사이에 들어와도 놓치지 않는다.
+    sigset_t stop_signals, prev_mask;
+    sigemptyset( &stop_signals );
+    sigaddset( &stop_signals, SIGINT  );
+    sigaddset( &stop_signals, SIGTERM );
+    sigaddset( &stop_signals, SIGHUP  );
+    sigaddset( &stop_signals, SIGQUIT );
+    pthread_sigmask( SIG_BLOCK, &stop_signals, &prev_mask );
+
+    // 1. 워커 스레드 생성 (INLINE 모드는 Reactor가 직접 처리하므로 생략)
+    for( int i = 0; ctx->config.dispatch_mode != SERVER_DISPATCH_INLINE && i < ctx->worker_count; ++i )
     {
-        perror( "[TcpServer] Bind failed" );
-        return false;
+        ServerWorker* worker = &ctx->workers[i];
+        worker->thread_started
+            = ( pthread_create( &worker->thread, NULL, WorkerThreadFunc, worker ) == 0 );
     }
 
-    if( listen( ctx->listen_fd, 100 ) < 0 )
+    // 2. 송신 스레드 생성 (INLINE 모드는 호출 스레드가 직접 쓰므로 생략)
+    if( ctx->config.dispatch_mode != SERVER_DISPATCH_INLINE )
+        ctx->sender_started = ( pthread_create( &ctx->sender_thread, NULL, SenderThreadFunc, ctx ) == 0 );
+
+    // 3. 추가 Reactor 스레드 생성 (Reactor 0 은 현재 스레드에서 실행)
+    for( int i = 0; i < ctx->reactor_count; ++i )
+        ctx->reactors[i].is_running = true;
+
+    for( int i = 1; i < ctx->reactor_count; ++i )
     {
-        perror( "[TcpServer] Listen failed" );
-        return false;
+        ServerReactor* reactor = &ctx->reactors[i];
+        reactor->thread_started
+            = ( pthread_create( &reactor->thread, NULL, ReactorThreadFunc, reactor ) == 0 );
     }
 
-    // Epoll 처리를 위해 Non-blocking 설정
-    SetNonBlocking( ctx->listen_fd );
+    pthread_sigmask( SIG_SETMASK, &prev_mask, NULL );
 
-    // Epoll에 Listen 소켓 등록
-    struct epoll_event ev;
-    ev.events  = EPOLLIN; // 읽기 이벤트 감지
-    ev.data.fd = ctx->listen_fd;
+    printf( "[TcpServer] Server loop started (%s x %d).\n",
+            ( ctx->io_backend == SERVER_IO_URING ) ? "io_uring" : "Epoll", ctx->reactor_count );
 
-    if( epoll_ctl( ctx->epoll_fd, EPOLL_CTL_ADD, ctx->listen_fd, &ev ) < 0 )
-    {
-        perror( "[TcpServer] Epoll control failed" );
-        return false;
-    }
+    // 4. IO 루프 (Main IO Thread)
+    RunReactor( &ctx->reactors[0], exit_flag );
 
-    // Epoll 이벤트 버퍼 할당
-    ctx->events = (struct epoll_event*)malloc( sizeof( struct epoll_event ) * MAX_EPOLL_EVENTS );
+    // 5. 나머지 Reactor 정지 및 대기
+    for( int i = 1; i < ctx->reactor_count; ++i )
+    {
+        ServerReactor* reactor = &ctx->reactors[i];
+        reactor->is_running = false;
+        WakeReactor( reactor );
 
-    printf( "[TcpServer] Initialized on port %d\n", port );
-    return true;
+        if( reactor->thread_started )
+        {
+            pthread_join( reactor->thread, NULL );
+            reactor->thread_started = false;
+        }
+    }
 }
 
-static void impl_Server_Run( TcpServerContext* ctx, volatile bool* exit_flag )
+static void impl_Server_Stop( TcpServerContext* ctx )
 {
     if( !ctx )
         return;
 
-    ctx->is_running = true;
+    ctx->stop_requested = true;
+    WakeAllReactors( ctx );
+}
 
-    // 1. 워커 스레드 생성
-    pthread_create( &ctx->worker_thread, NULL, WorkerThreadFunc, ctx );
+// 호출 스레드에서 바로 쓸 때(직접 쓰기, INLINE 모드) 사용하는 암호화 임시 버퍼
+static __thread char tls_enc_buf[DEFAULT_BUF_SIZE];
 
-    // 2. 송신 스레드 생성
-    pthread_create( &ctx->sender_thread, NULL, SenderThreadFunc, ctx );
+// TrySendDirect 결과
+typedef enum
+{
+    DIRECT_WRITTEN = 0, // 소켓에 썼거나 연결별 송신 대기열에 예약함
+    DIRECT_DROPPED,     // 대상 연결이 없거나 대기열 한도 초과로 버림
+    DIRECT_DEFERRED     // 앞선 요청이 SendQueue 에 남아있어 순서를 위해 큐로 보내야 함
+} DirectResult;
 
-    printf( "[TcpServer] Server loop started (Epoll).\n" );
+/**
+ * ##   송신 스레드를 거치지 않고 호출한 스레드에서 바로 프레임을 쓴다. (Non-blocking)
+ * #### 그 연결 앞으로 SendQueue 에 밀린 요청(또는 아직 처리되지 않은 Broadcast)이 있으면 앞지르지 않도록 DEFERRED.
+ * #### 소켓이 가득 차면(EAGAIN) 남은 바이트는 연결별 송신 대기열로 가고 Reactor가 이어 보낸다. (WriteFrame)
+ */
+static DirectResult TrySendDirect( TcpServerContext* ctx, ConnHandle conn, const char* target, const void* body, int len )
+{
+    if( __atomic_load_n( &ctx->pending_broadcasts, __ATOMIC_ACQUIRE ) > 0 )
+        return DIRECT_DEFERRED;
 
-    // 3. Epoll 루프 (Main IO Thread)
-    while( ctx->is_running )
-    {
-        // 외부 종료 플래그 체크
-        if( exit_flag && *exit_flag )
-        {
-            printf( "[TcpServer] Stop signal detected. Exiting loop...\n" );
-            break;
-        }
+    DirectResult result  = DIRECT_DROPPED;
+    bool         written = false; // WriteFrame 까지 갔음 (Drop 이면 WriteFrame 이 이미 셈)
+    int          guard   = Epoch_Enter( ctx->client_epoch );
+    ClientNode*  node    = LookupConn( ctx, conn );
 
-        // 100ms 타임아웃으로 대기 (종료 시그널 체크를 위해)
-        int n_fds = epoll_wait( ctx->epoll_fd, ctx->events, MAX_EPOLL_EVENTS, 100 );
+    if( node && __atomic_load_n( &node->send_queued, __ATOMIC_ACQUIRE ) > 0 )
+    {
+        result = DIRECT_DEFERRED;
+    }
+    else if( node )
+    {
+        PacketFrame frame;
 
-        if( n_fds < 0 )
+        if( Packet_BuildFrame( &frame, target, body, len, ctx->encrypt_fn, tls_enc_buf ) > 0 )
         {
-            // 시그널 인터럽트는 무시
-            if( errno == EINTR ) continue;
-            break;
+            written = true;
+            if( WriteFrame( ctx, node, &frame, NULL, NULL ) )
+                result = DIRECT_WRITTEN;
         }
+    }
 
-        for( int i = 0; i < n_fds; ++i )
-        {
-            int curr_fd = ctx->events[i].data.fd;
-
-            // [Case A] 새로운 클라이언트 접속
-            if( curr_fd == ctx->listen_fd )
-            {
-                struct sockaddr_in cli_addr;
-                socklen_t cli_len = sizeof( cli_addr );
-                int client_fd = accept( ctx->listen_fd, (struct sockaddr*)&cli_addr, &cli_len );
+    Epoch_Exit( ctx->client_epoch, guard );
 
-                if( client_fd >= 0 )
-                {
-                    SetNonBlocking( client_fd );
+    // 대상 연결이 없거나(끊긴 핸들) 프레임을 만들지 못함 (큰 바디 등)
+    if( result == DIRECT_DROPPED && !written )
+        Metrics_Add( ctx->metrics, METRIC_SEND_DROPS, 1 );
 
-                    struct epoll_event ev;
-                    ev.events  = EPOLLIN | EPOLLET;
-                    ev.data.fd = client_fd;
+    return result;
+}
 
-                    epoll_ctl( ctx->epoll_fd, EPOLL_CTL_ADD, client_fd, &ev );
+/**
+ * ## 송신 태스크를 SendQueue에 넣는다. 실패하면 태스크를 해제한다.
+ * INLINE 모드에서는 큐를 거치지 않고 호출한 스레드에서 바로 쓴다.
+ */
+static bool EnqueueSendTask( TcpServerContext* ctx, ServerSendTask* task )
+{
+    // 태스크 할당 실패도 버린 프레임으로 센다.
+    if( !task )
+    {
+        Metrics_Add( ctx->metrics, METRIC_SEND_DROPS, 1 );
+        return false;
+    }
 
-                    AddClient( ctx, client_fd );
+    if( ctx->config.dispatch_mode == SERVER_DISPATCH_INLINE )
+    {
+        bool result = ProcessSendTask( ctx, task, tls_enc_buf, false, NULL );
+        FreeSendTask( task );
+        return result;
+    }
 
-                    // 핸드셰이크 전송 (평문, XOR 통보)
-                    SecurityStrategyBody strat_body;
-                    strat_body.strategy_code = SEC_STRATEGY_XOR;
+    bool queued = false;
 
-                    // 직렬화용 임시 버퍼
-                    char hs_buf[DEFAULT_BUF_SIZE];
+    if( task->is_broadcast )
+    {
+        // 처리될 때까지 모든 연결의 직접 쓰기를 막는다. (Broadcast 이전에 보낸 것이 뒤에 도착하지 않도록)
+        __atomic_add_fetch( &ctx->pending_broadcasts, 1, __ATOMIC_ACQ_REL );
 
-                    // 암호화 함수 인자에 NULL 전달 -> 평문 헤더+바디 생성
-                    int hs_len
-                        = Packet_Serialize( hs_buf, DEFAULT_BUF_SIZE, TARGET_SEC_STRATEGY,
-                                            &strat_body, sizeof(SecurityStrategyBody), NULL /* 평문 */ );
+        queued = SafeQueue_Enqueue( ctx->send_queue, task );
+        if( !queued )
+            __atomic_sub_fetch( &ctx->pending_broadcasts, 1, __ATOMIC_RELEASE );
+    }
+    else
+    {
+        // 송신 스레드가 쓸 때까지 이 연결의 직접 쓰기를 막는다.
+        int         guard = Epoch_Enter( ctx->client_epoch );
+        ClientNode* node  = LookupConn( ctx, task->conn );
 
-                    if( hs_len > 0 ){
-                        send( client_fd, hs_buf, hs_len, MSG_NOSIGNAL );
-                    }
+        if( node )
+        {
+            __atomic_add_fetch( &node->send_queued, 1, __ATOMIC_ACQ_REL );
 
-                    printf( "[TcpServer] Client %d connected. Handshake sent (Strategy: XOR).\n", client_fd );
-                }
-            }
-            // [Case B] 데이터 수신 (From Client)
-            else
-            {
-                char* temp_buf = (char*)malloc( DEFAULT_BUF_SIZE );
-                if( !temp_buf )
-                    continue;
+            queued = SafeQueue_Enqueue( ctx->send_queue, task ); // Non-blocking (가득 차면 실패)
+            if( !queued )
+                __atomic_sub_fetch( &node->send_queued, 1, __ATOMIC_RELEASE );
+        }
 
-                int len = recv( curr_fd, temp_buf, DEFAULT_BUF_SIZE, 0 );
-                if( len > 0 )
-                {
-                    // 수신된 데이터를 Task로 포장하여 RecvQueue로 전달
-                    ServerRecvTask* task = (ServerRecvTask*)malloc( sizeof( ServerRecvTask ) );
-                    if( task )
-                    {
-                        task->client_fd = curr_fd;
-                        task->data      = temp_buf; // 메모리 소유권 이전
-                        task->len       = len;
-
-                        // 큐가 가득 찼으면 Drop (Backpressure)
-                        if( !SafeQueue_Enqueue( ctx->recv_queue, task ) )
-                        {
-                            // printf( "[TcpServer] RecvQueue Full! Dropping packet from %d\n", curr_fd );
-                            FreeRecvTask( task ); // task와 data 모두 해제됨
-                        }
-                    }
-                    else { free( temp_buf ); }
-                }
-                else
-                {
-                    // 연결 종료 (0) 또는 에러 (<0)
-                    close( curr_fd ); // Epoll에서 자동 제거됨
-                    RemoveClient( ctx, curr_fd );
-                    free( temp_buf );
+        Epoch_Exit( ctx->client_epoch, guard );
+    }
 
-                    // printf( "[TcpServer] Client %d disconnected.\n", curr_fd );
-                }
-            }
-        }
+    if( !queued )
+    {
+        Metrics_Add( ctx->metrics, METRIC_SEND_DROPS, 1 );
+        FreeSendTask( task );
     }
+
+    return queued;
 }
 
-static bool impl_Server_Send( TcpServerContext* ctx, int client_fd, const char* target, void* body, int len )
+static bool impl_Server_Send( TcpServerContext* ctx, ConnHandle conn, const char* target, void* body, int len )
 {
-    if( !ctx || !ctx->is_running )
+    if( !ctx || !ctx->is_running || conn == CONN_HANDLE_INVALID )
         return false;
 
-    // SendTask 생성
-    ServerSendTask* task = (ServerSendTask*)malloc( sizeof( ServerSendTask ) );
+    // 1. 밀린 요청이 없으면 호출 스레드에서 바로 쓴다. (태스크/복사 없음)
+    DirectResult direct = TrySendDirect( ctx, conn, target, body, len );
+    if( direct != DIRECT_DEFERRED )
+        return ( direct == DIRECT_WRITTEN );
 
-    if( !task )
-        return false;
+    // 2. SendTask 생성 (작은 바디는 태스크 블록에 함께 복사됨)
+    return EnqueueSendTask( ctx, AllocSendTask( ctx, conn, false, target, body, len ) );
+}
 
-    task->client_fd    = client_fd;
-    task->is_broadcast = false;
+static bool impl_Server_SendOwned( TcpServerContext* ctx, ConnHandle conn, const char* target,
+                                   void* body, int len, ReleaseBodyFunc release_fn )
+{
+    ServerSendTask* task   = NULL;
+    DirectResult    direct = DIRECT_DROPPED;
 
-    memset( task->target, 0, TARGET_NAME_LEN );
-    if( target ) strncpy( task->target, target, TARGET_NAME_LEN );
+    if( ctx && ctx->is_running && conn != CONN_HANDLE_INVALID )
+    {
+        // 밀린 요청이 없으면 바로 쓰고 해제한다. (남은 바이트는 WriteFrame 이 복사해 둠)
+        direct = TrySendDirect( ctx, conn, target, body, body ? len : 0 );
 
-    // 바디 데이터 Deep Copy (비동기 전송을 위해 필수)
-    if( body && len > 0 )
+        if( direct == DIRECT_DEFERRED )
+            task = AllocSendTaskHeader( ctx, conn, false, target );
+    }
+
+    // 실패하거나 바로 썼어도 소유권은 넘어왔으므로 여기서 해제한다.
+    if( !task )
     {
-        task->body_data = (char*)malloc( len );
-        if( !task->body_data )
+        // 큐로 보내야 했지만 태스크를 할당하지 못함 (EnqueueSendTask 의 할당 실패와 같은 Drop)
+        if( direct == DIRECT_DEFERRED )
+            Metrics_Add( ctx->metrics, METRIC_SEND_DROPS, 1 );
+
+        if( body )
         {
-            free( task );
-            return false;
+            if( release_fn ) release_fn( body );
+            else             free( body );
         }
-        memcpy( task->body_data, body, len );
-        task->body_len = len;
+        return ( direct == DIRECT_WRITTEN );
     }
-    else
+
+    // 복사 없이 포인터만 넘긴다. (Sender가 전송 후 release_fn 호출)
+    if( body && len > 0 )
+    {
+        task->body_data    = (char*)body;
+        task->body_len     = len;
+        task->body_release = release_fn;
+    }
+    else if( body )
     {
-        task->body_data = NULL;
-        task->body_len = 0;
+        if( release_fn ) release_fn( body );
+        else             free( body );
     }
 
-    if( !SafeQueue_Enqueue( ctx->send_queue, task ) )
+    return EnqueueSendTask( ctx, task );
+}
+
+static bool impl_Server_SendRef( TcpServerContext* ctx, ConnHandle conn, const char* target, SharedBuffer* body )
+{
+    if( !ctx || !ctx->is_running || conn == CONN_HANDLE_INVALID )
+        return false;
+
+    // 밀린 요청이 없으면 바로 쓴다. (남은 바이트는 대기열이 복사해 두므로 참조를 잡을 필요 없음)
+    bool         has_body = ( body && body->len > 0 );
+    DirectResult direct   = TrySendDirect( ctx, conn, target, has_body ? body->data : NULL, has_body ? body->len : 0 );
+    if( direct != DIRECT_DEFERRED )
+        return ( direct == DIRECT_WRITTEN );
+
+    ServerSendTask* task = AllocSendTaskHeader( ctx, conn, false, target );
+
+    if( !task )
     {
-        FreeSendTask( task );
+        Metrics_Add( ctx->metrics, METRIC_SEND_DROPS, 1 );
         return false;
     }
 
-    return true;
+    // 참조만 하나 더 잡는다. (Sender가 전송 후 Release)
+    if( body && body->len > 0 )
+    {
+        SharedBuffer_Retain( body );
+
+        task->body_ref  = body;
+        task->body_data = body->data;
+        task->body_len  = body->len;
+    }
+
+    return EnqueueSendTask( ctx, task );
 }
 
 static bool impl_Server_Broadcast( TcpServerContext* ctx, const char* target, void* body, int len )
@@ -484,41 +3330,140 @@ static bool impl_Server_Broadcast( TcpServerContext* ctx, const char* target, vo
     if( !ctx || !ctx->is_running )
         return false;
 
-    ServerSendTask* task = (ServerSendTask*)malloc( sizeof( ServerSendTask ) );
+    // 대상 핸들은 Broadcast에서 무시됨
+    return EnqueueSendTask( ctx, AllocSendTask( ctx, CONN_HANDLE_INVALID, true, target, body, len ) );
+}
 
-    if( !task )
+static bool impl_Server_Cork( TcpServerContext* ctx, ConnHandle conn )
+{
+    if( !ctx || conn == CONN_HANDLE_INVALID )
         return false;
 
-    task->client_fd    = -1; // Broadcast에서는 무시됨
-    task->is_broadcast = true;
+    int         guard = Epoch_Enter( ctx->client_epoch );
+    ClientNode* node  = LookupConn( ctx, conn );
 
-    memset( task->target, 0, TARGET_NAME_LEN );
-    if( target ) strncpy( task->target, target, TARGET_NAME_LEN );
+    if( node )
+    {
+        pthread_mutex_lock( &node->out_mutex );
+        node->cork_depth++;
+        pthread_mutex_unlock( &node->out_mutex );
+    }
 
-    if( body && len > 0 )
+    Epoch_Exit( ctx->client_epoch, guard );
+    return ( node != NULL );
+}
+
+static void impl_Server_Uncork( TcpServerContext* ctx, ConnHandle conn )
+{
+    if( !ctx || conn == CONN_HANDLE_INVALID )
+        return;
+
+    int         guard = Epoch_Enter( ctx->client_epoch );
+    ClientNode* node  = LookupConn( ctx, conn );
+
+    if( node )
     {
-        task->body_data = (char*)malloc( len );
-        if( !task->body_data )
+        pthread_mutex_lock( &node->out_mutex );
         {
-            free( task );
-            return false;
+            if( node->cork_depth > 0 )
+                node->cork_depth--;
+
+            // 가장 바깥 Uncork: 모아둔 프레임을 한 번에 보낸다. (송신 배치에 등록되어 있으면 배치 끝에 함께 보냄)
+            if( node->cork_depth == 0 && !node->in_send_batch )
+                FlushHeldLocked( ctx, node, 0 );
         }
-        memcpy( task->body_data, body, len );
-        task->body_len = len;
+        pthread_mutex_unlock( &node->out_mutex );
     }
-    else
+
+    Epoch_Exit( ctx->client_epoch, guard );
+}
+
+/**
+ * ## 사용자 타이머를 등록하고 Reactor 0 을 깨워 대기 시간을 다시 계산하게 한다.
+ */
+static ServerTimerId AddServerTimer( TcpServerContext* ctx, int delay_ms, int interval_ms,
+                                     OnServerTimerCallback callback, void* arg )
+{
+    if( !ctx || !callback )
+        return SERVER_TIMER_INVALID;
+
+    ServerTimer* timer = (ServerTimer*)calloc( 1, sizeof( ServerTimer ) );
+    if( !timer )
+        return SERVER_TIMER_INVALID;
+
+    uint64_t now = MonotonicMs();
+
+    TimerEntry_Init( &timer->entry, OnServerTimerExpired, timer );
+    timer->ctx         = ctx;
+    timer->callback    = callback;
+    timer->arg         = arg;
+    timer->interval_ms = interval_ms;
+    timer->due_ms      = now + (uint64_t)delay_ms;
+
+    ServerTimerId id;
+
+    pthread_mutex_lock( &ctx->timer_mutex );
     {
-        task->body_data = NULL;
-        task->body_len = 0;
+        id        = ctx->next_timer_id++;
+        timer->id = id;
+
+        timer->next = ctx->timer_list;
+        if( ctx->timer_list )
+            ctx->timer_list->prev = timer;
+        ctx->timer_list = timer;
+
+        TimerWheel_Schedule( ctx->timer_wheel, &timer->entry, now, (uint64_t)delay_ms );
     }
+    pthread_mutex_unlock( &ctx->timer_mutex );
 
-    if( !SafeQueue_Enqueue( ctx->send_queue, task ) )
-    {
-        FreeSendTask( task );
+    if( ctx->reactors && ctx->reactor_count > 0 )
+        WakeReactor( &ctx->reactors[0] );
+
+    return id; // 등록 직후 만료되어 해제될 수 있으므로 timer 를 다시 읽지 않는다.
+}
+
+static ServerTimerId impl_Server_ScheduleTimer( TcpServerContext* ctx, int delay_ms,
+                                                OnServerTimerCallback callback, void* arg )
+{
+    return AddServerTimer( ctx, ( delay_ms > 0 ) ? delay_ms : 0, 0, callback, arg );
+}
+
+static ServerTimerId impl_Server_SchedulePeriodic( TcpServerContext* ctx, int interval_ms,
+                                                   OnServerTimerCallback callback, void* arg )
+{
+    if( interval_ms < 1 )
+        return SERVER_TIMER_INVALID;
+
+    return AddServerTimer( ctx, interval_ms, interval_ms, callback, arg );
+}
+
+static bool impl_Server_CancelTimer( TcpServerContext* ctx, ServerTimerId id )
+{
+    if( !ctx || id == SERVER_TIMER_INVALID )
         return false;
+
+    bool found = false;
+
+    pthread_mutex_lock( &ctx->timer_mutex );
+    {
+        ServerTimer* timer = ctx->timer_list;
+        while( timer && timer->id != id )
+            timer = timer->next;
+
+        if( timer && !timer->cancelled )
+        {
+            found            = true;
+            timer->cancelled = true;
+            TimerWheel_Cancel( ctx->timer_wheel, &timer->entry );
+
+            // 워커에 맡겨진 상태면 실행을 마친 워커가 해제한다.
+            if( !timer->busy )
+                FreeServerTimerLocked( ctx, timer );
+        }
     }
+    pthread_mutex_unlock( &ctx->timer_mutex );
 
-    return true;
+    return found;
 }
 
 static void impl_Server_SetStrategy( TcpServerContext* ctx, EncryptFunc enc, DecryptFunc dec )
@@ -535,52 +3480,88 @@ static void impl_Server_Destroy( TcpServerContext* ctx )
     if( !ctx ) return;
 
     ctx->is_running = false; // 루프 종료 플래그
+    WakeAllReactors( ctx );  // 다른 스레드에서 Run 이 대기 중이면 깨운다.
 
-    // 1. 워커 스레드 종료 신호
-    ServerRecvTask* poison_for_worker = (ServerRecvTask*)malloc( sizeof( ServerRecvTask ) );
-    if( poison_for_worker ){
-        poison_for_worker->client_fd = -1;
-        poison_for_worker->data = NULL;
-        SafeQueue_Enqueue( ctx->recv_queue, poison_for_worker );
+    // 1. 워커 스레드 종료 신호 (워커마다 자신의 큐로 하나씩)
+    for( int i = 0; i < ctx->worker_count; ++i )
+    {
+        ServerRecvTask* poison_for_worker = AllocRecvTask( ctx ); // conn = CONN_HANDLE_INVALID
+        if( poison_for_worker ){
+            if( !SafeQueue_Enqueue( ctx->workers[i].recv_queue, poison_for_worker ) )
+                FreeRecvTask( poison_for_worker ); // 큐가 가득 참: 워커는 is_running 확인으로 종료됨
+        }
     }
 
     // 2. 송신 스레드용 종료 태스크
-    ServerSendTask* poison_for_sender = (ServerSendTask*)malloc( sizeof( ServerSendTask ) );
+    ServerSendTask* poison_for_sender = AllocSendTask( ctx, CONN_HANDLE_INVALID /* 종료 신호 */, false, NULL, NULL, 0 );
     if( poison_for_sender ){
-        poison_for_sender->client_fd = -2; // 종료 코드
-        poison_for_sender->body_data = NULL;
-        SafeQueue_Enqueue( ctx->send_queue, poison_for_sender );
+        if( !SafeQueue_Enqueue( ctx->send_queue, poison_for_sender ) )
+            FreeSendTask( poison_for_sender );
     }
 
     // 3. 스레드 종료 대기 (Join)
-    pthread_join( ctx->worker_thread, NULL );
-    pthread_join( ctx->sender_thread, NULL );
+    for( int i = 0; i < ctx->worker_count; ++i )
+    {
+        if( ctx->workers[i].thread_started )
+            pthread_join( ctx->workers[i].thread, NULL );
+    }
+    if( ctx->sender_started )
+        pthread_join( ctx->sender_thread, NULL );
 
     // 4. 자원 해제
-    if( ctx->listen_fd >= 0 ) close( ctx->listen_fd );
-    if( ctx->epoll_fd  >= 0 ) close( ctx->epoll_fd  );
+    for( int i = 0; i < ctx->reactor_count; ++i )
+    {
+        ServerReactor* reactor = &ctx->reactors[i];
+        reactor->is_running = false;
+        WakeReactor( reactor );
+
+        // Run 없이 Destroy 되거나 Run이 비정상 종료된 경우 대비
+        if( reactor->thread_started )
+            pthread_join( reactor->thread, NULL );
+
+        DestroyReactor( reactor );
+    }
 
     // 큐 파괴 (SafeQueue_Destroy가 내부 데이터까지 FreeRecvTask/FreeSendTask 호출로 정리함)
-    SafeQueue_Destroy( ctx->recv_queue, FreeRecvTask );
+    for( int i = 0; i < ctx->worker_count; ++i )
+        SafeQueue_Destroy( ctx->workers[i].recv_queue, FreeRecvTask );
     SafeQueue_Destroy( ctx->send_queue, FreeSendTask );
 
-    // 클라이언트 리스트 정리
-    pthread_mutex_lock( &ctx->client_list_mutex );
+    // 풀은 큐에 남은 태스크가 모두 반납된 뒤 파괴한다.
+    BufferPool_Destroy( ctx->recv_pool );
+    BufferPool_Destroy( ctx->send_pool );
+
+    // 클라이언트 테이블 정리 (모든 스레드가 종료되었으므로 바로 해제)
+    for( int fd = 0; ctx->client_table && fd < ctx->client_high_fd; ++fd )
     {
-        ClientNode* curr = ctx->client_list_head;
-        while( curr != NULL )
+        ClientNode* node = ctx->client_table[fd];
+        if( node )
         {
-            ClientNode* next = curr->next;
-            close( curr->fd ); // 아직 안 닫힌 소켓 정리
-            free( curr );
-            curr = next;
+            close( node->fd ); // 아직 안 닫힌 소켓 정리
+            FreeClientNode( node );
+            ctx->client_table[fd] = NULL;
         }
-        ctx->client_list_head = NULL;
     }
-    pthread_mutex_unlock ( &ctx->client_list_mutex );
-    pthread_mutex_destroy( &ctx->client_list_mutex );
 
-    if( ctx->events ) free( ctx->events );
+    // 유예 기간 중이던 노드까지 해제
+    Epoch_Destroy( ctx->client_epoch );
+
+    // 연결들의 송신 대기열이 모두 해제된 뒤 마지막 참조를 놓는다.
+    SharedBuffer_Release( ctx->handshake_frame );
+    SharedBuffer_Release( ctx->heartbeat_frame );
+
+    // 남은 사용자 타이머 (모든 스레드가 종료되었으므로 실행 중인 것 없음)
+    while( ctx->timer_list )
+        FreeServerTimerLocked( ctx, ctx->timer_list );
+    TimerWheel_Destroy( ctx->timer_wheel );
+    pthread_mutex_destroy( &ctx->timer_mutex );
+
+    Metrics_Destroy( ctx->metrics );
+
+    if( ctx->client_table       ) free( ctx->client_table );
+    if( ctx->client_generations ) free( ctx->client_generations );
+    if( ctx->reactors           ) free( ctx->reactors );
+    if( ctx->workers            ) free( ctx->workers );
     free( ctx );
 
     printf( "[TcpServer] Destroyed successfully.\n" );
@@ -590,15 +3571,103 @@ static int impl_GetClientCount( TcpServerContext* ctx )
 {
     if( !ctx )
         return 0;
-    // Mutex를 걸고 읽을 수도 있지만, volatile int는 읽기 atomic을 기대하고 단순 반환 (통계용)
-    return ctx->current_client_count;
+    // 등록/제거 시 원자적으로 갱신되므로 Lock 없이 읽는다. (통계용)
+    return __atomic_load_n( &ctx->current_client_count, __ATOMIC_RELAXED );
+}
+
+static void impl_GetRecvPoolStats( TcpServerContext* ctx, BufferPoolStats* out )
+{
+    BufferPool_GetStats( ctx ? ctx->recv_pool : NULL, out );
+}
+
+static void impl_GetSendPoolStats( TcpServerContext* ctx, BufferPoolStats* out )
+{
+    BufferPool_GetStats( ctx ? ctx->send_pool : NULL, out );
+}
+
+static void impl_GetBackpressureStats( TcpServerContext* ctx, ServerBackpressureStats* out )
+{
+    if( !out )
+        return;
+
+    memset( out, 0, sizeof( ServerBackpressureStats ) );
+
+    if( !ctx )
+        return;
+
+    for( int i = 0; i < ctx->worker_count; ++i )
+    {
+        ServerWorker* worker = &ctx->workers[i];
+
+        if( __atomic_load_n( &worker->read_paused, __ATOMIC_RELAXED ) )
+            out->paused_workers++;
+
+        out->pause_count  += __atomic_load_n( &worker->pause_count,  __ATOMIC_RELAXED );
+        out->resume_count += __atomic_load_n( &worker->resume_count, __ATOMIC_RELAXED );
+    }
+
+    out->paused_connections = __atomic_load_n( &ctx->paused_connections, __ATOMIC_RELAXED );
+}
+
+static void impl_GetStats( TcpServerContext* ctx, TcpStats* out )
+{
+    if( !out )
+        return;
+
+    Metrics_GetStats( ctx ? ctx->metrics : NULL, out );
+
+    if( !ctx )
+        return;
+
+    // 큐 현황 (워커 큐는 깊이는 합, 최고 기록은 가장 많이 찬 큐 기준)
+    for( int i = 0; i < ctx->worker_count; ++i )
+    {
+        int high = SafeQueue_HighWatermark( ctx->workers[i].recv_queue );
+
+        out->recv_queue_depth += SafeQueue_Size( ctx->workers[i].recv_queue );
+        if( high > out->recv_queue_high )
+            out->recv_queue_high = high;
+    }
+
+    out->send_queue_depth = SafeQueue_Size( ctx->send_queue );
+    out->send_queue_high  = SafeQueue_HighWatermark( ctx->send_queue );
 }
 
 // --------------------------------------------------------------------------
-// 8. 생성자 구현
+// 12. 생성자 구현
 // --------------------------------------------------------------------------
 
+TcpServerConfig TcpServer_GetDefaultConfig( void )
+{
+    TcpServerConfig config;
+    memset( &config, 0, sizeof( TcpServerConfig ) );
+
+    config.reactor_count         = 1;
+    config.worker_count          = 1;
+    config.outbound_buffer_size  = 64 * 1024;
+    config.io_backend            = SERVER_IO_EPOLL;
+    config.queue_type            = SAFE_QUEUE_LOCKED;
+    config.recv_pool_blocks      = 4096;
+    config.send_pool_blocks      = 4096;
+    config.recv_high_watermark   = QUEUE_CAPACITY * 3 / 4;
+    config.recv_low_watermark    = QUEUE_CAPACITY / 4;
+    config.send_coalesce_bytes   = 16 * 1024;
+    config.listen_backlog        = 4096;
+    config.listener_mode         = SERVER_LISTEN_REUSEPORT;
+    config.idle_timeout_ms       = 0;
+    config.heartbeat_interval_ms = 0;
+
+    return config;
+}
+
 TcpServerContext* CreateTcpServerContext( OnServerMessageCallback callback, void* service_ctx )
+{
+    TcpServerConfig config = TcpServer_GetDefaultConfig();
+    return CreateTcpServerContextEx( callback, service_ctx, &config );
+}
+
+TcpServerContext* CreateTcpServerContextEx( OnServerMessageCallback callback, void* service_ctx,
+                                            const TcpServerConfig* config )
 {
     TcpServerContext* ctx = (TcpServerContext*)malloc( sizeof( TcpServerContext ) );
 
@@ -607,33 +3676,149 @@ TcpServerContext* CreateTcpServerContext( OnServerMessageCallback callback, void
 
     memset( ctx, 0, sizeof( TcpServerContext ) );
 
-    ctx->listen_fd            = -1;
-    ctx->epoll_fd             = -1;
+    ctx->config               = config ? *config : TcpServer_GetDefaultConfig();
     ctx->on_message           = callback;
     ctx->service_ctx          = service_ctx;
     ctx->current_client_count = 0;
+    ctx->client_high_fd       = 0;
+    ctx->client_epoch         = Epoch_Create();
+
+    // FD -> ClientNode 인덱스 테이블 (프로세스 FD 한도만큼 할당)
+    struct rlimit rl;
+    ctx->client_table_size = MAX_CLIENT_FDS;
+    if( getrlimit( RLIMIT_NOFILE, &rl ) == 0 && rl.rlim_cur != RLIM_INFINITY && rl.rlim_cur < MAX_CLIENT_FDS )
+        ctx->client_table_size = (int)rl.rlim_cur;
+
+    ctx->client_table       = (struct ClientNode**)calloc( ctx->client_table_size, sizeof( struct ClientNode* ) );
+    ctx->client_generations = (uint32_t*)calloc( ctx->client_table_size, sizeof( uint32_t ) );
+
+    // Reactor 배열 (Epoll/리스너 생성은 Init 에서 수행)
+    if( ctx->config.reactor_count < 1 )
+        ctx->config.reactor_count = 1;
+
+    ctx->reactor_count = ctx->config.reactor_count;
+    ctx->reactors      = (struct ServerReactor*)calloc( ctx->reactor_count, sizeof( ServerReactor ) );
+
+    for( int i = 0; ctx->reactors && i < ctx->reactor_count; ++i )
+    {
+        ctx->reactors[i].ctx       = ctx;
+        ctx->reactors[i].index     = i;
+        ctx->reactors[i].listen_fd = -1;
+        ctx->reactors[i].epoll_fd  = -1;
+        ctx->reactors[i].wake_fd   = -1;
+    }
+
+    // 실제 사용할 백엔드 (io_uring 초기화 실패 시 Init 에서 epoll로 바뀜)
+    ctx->io_backend = ctx->config.io_backend;
+
+    // 송신 큐 한도는 최소한 최대 패킷 하나는 담을 수 있어야 한다.
+    if( ctx->config.outbound_buffer_size < DEFAULT_BUF_SIZE )
+        ctx->config.outbound_buffer_size = DEFAULT_BUF_SIZE;
+
+    // 묶음 전송 한도는 송신 대기열 안에 들어가야 한다. (0 이하: 송신 스레드의 묶음 전송 끔)
+    if( ctx->config.send_coalesce_bytes < 0 )
+        ctx->config.send_coalesce_bytes = 0;
+    if( ctx->config.send_coalesce_bytes > ctx->config.outbound_buffer_size )
+        ctx->config.send_coalesce_bytes = ctx->config.outbound_buffer_size;
+
+    if( ctx->config.listen_backlog <= 0 )
+        ctx->config.listen_backlog = SOMAXCONN;
+
+    // 유휴 타임아웃/Heartbeat (0 이하: 끔)
+    if( ctx->config.idle_timeout_ms < 0 )
+        ctx->config.idle_timeout_ms = 0;
+    if( ctx->config.heartbeat_interval_ms < 0 )
+        ctx->config.heartbeat_interval_ms = 0;
 
-    ctx->client_list_head = NULL;
-    pthread_mutex_init( &ctx->client_list_mutex, NULL );
+    // 워커 배열 (워커마다 자신의 RecvQueue 보유)
+    if( ctx->config.worker_count < 1 )
+        ctx->config.worker_count = 1;
+
+    ctx->worker_count = ctx->config.worker_count;
+    ctx->workers      = (struct ServerWorker*)calloc( ctx->worker_count, sizeof( ServerWorker ) );
+
+    bool workers_ok = ( ctx->workers != NULL );
+    for( int i = 0; ctx->workers && i < ctx->worker_count; ++i )
+    {
+        ctx->workers[i].ctx        = ctx;
+        ctx->workers[i].index      = i;
+        ctx->workers[i].recv_queue = SafeQueue_CreateEx( QUEUE_CAPACITY, ctx->config.queue_type );
+
+        if( !ctx->workers[i].recv_queue )
+            workers_ok = false;
+    }
+
+    // 읽기 중단/재개 기준 (high 는 큐 용량 이하, low 는 high 미만이어야 재개와 중단이 번갈아 반복되지 않음)
+    if( ctx->config.recv_high_watermark <= 0 || ctx->config.recv_high_watermark > QUEUE_CAPACITY )
+        ctx->config.recv_high_watermark = QUEUE_CAPACITY;
+
+    if( ctx->config.recv_low_watermark < 0 || ctx->config.recv_low_watermark >= ctx->config.recv_high_watermark )
+        ctx->config.recv_low_watermark = ctx->config.recv_high_watermark / 2;
 
     ctx->encrypt_fn = Packet_DefaultXor;
     ctx->decrypt_fn = Packet_DefaultXor;
 
-    ctx->recv_queue = SafeQueue_Create( QUEUE_CAPACITY );
-    ctx->send_queue = SafeQueue_Create( QUEUE_CAPACITY );
+    ctx->send_queue = SafeQueue_CreateEx( QUEUE_CAPACITY, ctx->config.queue_type );
+
+    // 수신 태스크 풀 (태스크 헤더 + 최대 패킷 크기 버퍼)
+    if( ctx->config.recv_pool_blocks < 1 )
+        ctx->config.recv_pool_blocks = QUEUE_CAPACITY;
 
-    if( !ctx->recv_queue || !ctx->send_queue ){
+    ctx->recv_pool = BufferPool_Create( sizeof( ServerRecvTask ) + DEFAULT_BUF_SIZE, ctx->config.recv_pool_blocks );
+
+    // 송신 태스크 풀 (작은 바디 포함)
+    if( ctx->config.send_pool_blocks < 1 )
+        ctx->config.send_pool_blocks = QUEUE_CAPACITY;
+
+    ctx->send_pool = BufferPool_Create( sizeof( ServerSendTask ), ctx->config.send_pool_blocks );
+
+    ctx->metrics = Metrics_Create();
+
+    // 사용자 타이머 (ScheduleTimer/SchedulePeriodic, Reactor 0 이 돌림)
+    ctx->timer_wheel   = TimerWheel_Create( SERVER_TIMER_TICK_MS, MonotonicMs() );
+    ctx->timer_list    = NULL;
+    ctx->next_timer_id = 1;
+
+    if( !workers_ok || !ctx->send_queue || !ctx->recv_pool || !ctx->send_pool || !ctx->client_table || !ctx->client_generations || !ctx->client_epoch || !ctx->reactors || !ctx->timer_wheel || !ctx->metrics ){
+        for( int i = 0; ctx->workers && i < ctx->worker_count; ++i )
+            SafeQueue_Destroy( ctx->workers[i].recv_queue, NULL );
+        SafeQueue_Destroy( ctx->send_queue, NULL );
+        BufferPool_Destroy( ctx->recv_pool );
+        BufferPool_Destroy( ctx->send_pool );
+        Epoch_Destroy( ctx->client_epoch );
+        TimerWheel_Destroy( ctx->timer_wheel );
+        Metrics_Destroy( ctx->metrics );
+        free( ctx->workers );
+        free( ctx->client_table );
+        free( ctx->client_generations );
+        free( ctx->reactors );
         free( ctx );
         return NULL;
     }
 
     ctx->Init           = impl_Server_Init;
     ctx->Run            = impl_Server_Run;
+    ctx->Stop           = impl_Server_Stop;
     ctx->Send           = impl_Server_Send;
+    ctx->SendOwned      = impl_Server_SendOwned;
+    ctx->SendRef        = impl_Server_SendRef;
     ctx->Broadcast      = impl_Server_Broadcast;
+    ctx->Cork           = impl_Server_Cork;
+    ctx->Uncork         = impl_Server_Uncork;
     ctx->SetStrategy    = impl_Server_SetStrategy;
     ctx->Destroy        = impl_Server_Destroy;
     ctx->GetClientCount = impl_GetClientCount;
 
+    ctx->GetRecvPoolStats = impl_GetRecvPoolStats;
+    ctx->GetSendPoolStats = impl_GetSendPoolStats;
+
+    ctx->GetBackpressureStats = impl_GetBackpressureStats;
+    ctx->GetStats             = impl_GetStats;
+
+    pthread_mutex_init( &ctx->timer_mutex, NULL );
+    ctx->ScheduleTimer    = impl_Server_ScheduleTimer;
+    ctx->SchedulePeriodic = impl_Server_SchedulePeriodic;
+    ctx->CancelTimer      = impl_Server_CancelTimer;
+
     return ctx;
 }
\ No newline at end of file
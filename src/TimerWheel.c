@@ -0,0 +1,294 @@
+/**
+ * 파일명: src/TimerWheel.c
+ *
+ * 개요:
+ * TimerWheel.h 에 선언된 계층형 타이머 휠 구현부.
+ *
+ * [구조]
+ * - WHEEL_LEVELS 단계 x WHEEL_SIZE 칸. 칸마다 만료 틱이 같은 범위인 타이머를 원형 이중 연결 리스트로 묶는다.
+ * - 단계 0 은 남은 틱이 WHEEL_SIZE 미만인 타이머를 만료 틱 그대로의 칸에 둔다.
+ *   단계 n 은 남은 틱이 WHEEL_SIZE^(n+1) 미만인 타이머를 만료 틱의 n번째 자리(WHEEL_BITS 단위) 칸에 둔다.
+ * - 단계 0 이 한 바퀴 돌 때마다 상위 단계의 다음 칸을 비워 하위 단계로 다시 등록한다. (Cascade)
+ *   타이머 하나는 최대 WHEEL_LEVELS 번만 옮겨지므로 등록/취소/만료 모두 상수 시간이다.
+ */
+
+#include "TimerWheel.h"
+
+#include <stdlib.h> // calloc, free
+
+// --------------------------------------------------------------------------
+// 내부 구조체 정의
+// --------------------------------------------------------------------------
+
+#define WHEEL_BITS   8
+#define WHEEL_SIZE   ( 1 << WHEEL_BITS ) // 단계당 칸 수
+#define WHEEL_MASK   ( WHEEL_SIZE - 1 )
+#define WHEEL_LEVELS 4                   // 표현 가능한 최대 지연: WHEEL_SIZE^4 틱 (1ms 틱 기준 약 49일)
+
+#define WHEEL_MAX_DELTA ( ( (uint64_t)1 << ( WHEEL_BITS * WHEEL_LEVELS ) ) - 1 )
+
+struct TimerWheel
+{
+    int      tick_ms;
+    uint64_t base_ms; // 틱 0 의 시각
+    uint64_t current; // 다음에 처리할 틱
+    int      count;   // 등록된 타이머 수
+
+    TimerEntry slots[WHEEL_LEVELS][WHEEL_SIZE]; // 칸마다 원형 리스트의 머리 (콜백 없는 빈 항목)
+};
+
+
+// --------------------------------------------------------------------------
+// 내부 함수
+// --------------------------------------------------------------------------
+
+static inline uint64_t TickOf( TimerWheel* wheel, uint64_t ms )
+{
+    return ( ms > wheel->base_ms ) ? ( ms - wheel->base_ms ) / (uint64_t)wheel->tick_ms : 0;
+}
+
+static inline void ListInit( TimerEntry* head )
+{
+    head->prev = head;
+    head->next = head;
+}
+
+static inline bool ListEmpty( const TimerEntry* head )
+{
+    return head->next == head;
+}
+
+static inline void ListAppend( TimerEntry* head, TimerEntry* entry )
+{
+    entry->prev       = head->prev;
+    entry->next       = head;
+    head->prev->next  = entry;
+    head->prev        = entry;
+}
+
+static inline void ListUnlink( TimerEntry* entry )
+{
+    entry->prev->next = entry->next;
+    entry->next->prev = entry->prev;
+    entry->prev       = NULL;
+    entry->next       = NULL;
+}
+
+/**
+ * ## 칸의 리스트를 통째로 dst 로 옮긴다. (칸은 빈 상태가 됨)
+ */
+static void ListMoveAll( TimerEntry* src, TimerEntry* dst )
+{
+    if( ListEmpty( src ) )
+    {
+        ListInit( dst );
+        return;
+    }
+
+    dst->next       = src->next;
+    dst->prev       = src->prev;
+    dst->next->prev = dst;
+    dst->prev->next = dst;
+
+    ListInit( src );
+}
+
+/**
+ * ## 남은 틱 수에 맞는 단계와 칸에 타이머를 연결한다.
+ * 이미 지난 만료 틱은 다음에 처리할 틱(current)의 칸에 둔다.
+ */
+static void AddEntry( TimerWheel* wheel, TimerEntry* entry )
+{
+    uint64_t expire = entry->expire;
+
+    if( expire < wheel->current )
+        expire = wheel->current;
+
+    uint64_t delta = expire - wheel->current;
+    if( delta > WHEEL_MAX_DELTA )
+    {
+        delta         = WHEEL_MAX_DELTA;
+        expire        = wheel->current + delta;
+        entry->expire = expire;
+    }
+
+    int level = 0;
+    while( level < WHEEL_LEVELS - 1 && delta >= ( (uint64_t)1 << ( WHEEL_BITS * ( level + 1 ) ) ) )
+        level++;
+
+    int index = (int)( ( expire >> ( WHEEL_BITS * level ) ) & WHEEL_MASK );
+    ListAppend( &wheel->slots[level][index], entry );
+}
+
+/**
+ * ## 단계 0 이 한 바퀴를 돌았을 때 상위 단계의 다음 칸들을 하위 단계로 내려보낸다.
+ * 단계 n 의 칸 번호가 0 으로 돌아왔을 때만 단계 n+1 도 내려보낸다.
+ */
+static void Cascade( TimerWheel* wheel )
+{
+    for( int level = 1; level < WHEEL_LEVELS; ++level )
+    {
+        int        index = (int)( ( wheel->current >> ( WHEEL_BITS * level ) ) & WHEEL_MASK );
+        TimerEntry moved;
+
+        ListMoveAll( &wheel->slots[level][index], &moved );
+
+        while( !ListEmpty( &moved ) )
+        {
+            TimerEntry* entry = moved.next;
+            ListUnlink( entry );
+            AddEntry( wheel, entry );
+        }
+
+        if( index != 0 )
+            break;
+    }
+}
+
+
+// --------------------------------------------------------------------------
+// 함수 구현
+// --------------------------------------------------------------------------
+
+TimerWheel* TimerWheel_Create( int tick_ms, uint64_t now_ms )
+{
+    TimerWheel* wheel = (TimerWheel*)calloc( 1, sizeof( TimerWheel ) );
+    if( !wheel ){
+        return NULL;
+    }
+
+    wheel->tick_ms = ( tick_ms > 0 ) ? tick_ms : 1;
+    wheel->base_ms = now_ms;
+    wheel->current = 0;
+    wheel->count   = 0;
+
+    for( int level = 0; level < WHEEL_LEVELS; ++level )
+    {
+        for( int i = 0; i < WHEEL_SIZE; ++i )
+            ListInit( &wheel->slots[level][i] );
+    }
+
+    return wheel;
+}
+
+void TimerWheel_Destroy( TimerWheel* wheel )
+{
+    free( wheel );
+}
+
+void TimerEntry_Init( TimerEntry* entry, TimerFunc callback, void* arg )
+{
+    entry->prev     = NULL;
+    entry->next     = NULL;
+    entry->expire   = 0;
+    entry->callback = callback;
+    entry->arg      = arg;
+}
+
+bool TimerEntry_IsActive( const TimerEntry* entry )
+{
+    return entry->next != NULL;
+}
+
+void TimerWheel_Schedule( TimerWheel* wheel, TimerEntry* entry, uint64_t now_ms, uint64_t delay_ms )
+{
+    if( !wheel || !entry )
+        return;
+
+    TimerWheel_Cancel( wheel, entry );
+
+    // 만료 시각 이후의 첫 틱 (올림: 정해진 시간보다 일찍 만료되지 않도록)
+    uint64_t at = now_ms + delay_ms;
+    entry->expire = ( at > wheel->base_ms )
+                  ? ( at - wheel->base_ms + (uint64_t)wheel->tick_ms - 1 ) / (uint64_t)wheel->tick_ms
+                  : 0;
+
+    AddEntry( wheel, entry );
+    wheel->count++;
+}
+
+void TimerWheel_Cancel( TimerWheel* wheel, TimerEntry* entry )
+{
+    if( !wheel || !entry || !TimerEntry_IsActive( entry ) )
+        return;
+
+    ListUnlink( entry );
+    wheel->count--;
+}
+
+int TimerWheel_Advance( TimerWheel* wheel, uint64_t now_ms )
+{
+    if( !wheel )
+        return 0;
+
+    uint64_t target = TickOf( wheel, now_ms );
+    int      fired  = 0;
+
+    while( wheel->current <= target )
+    {
+        // 타이머가 없으면 지난 틱을 하나씩 돌 필요가 없다.
+        if( wheel->count == 0 )
+        {
+            wheel->current = target + 1;
+            break;
+        }
+
+        int index = (int)( wheel->current & WHEEL_MASK );
+
+        if( index == 0 )
+            Cascade( wheel );
+
+        // 만료된 칸을 떼어낸 뒤 틱을 먼저 넘긴다.
+        // (콜백이 지금 틱으로 다시 등록해도 떼어낸 칸이 아닌 다음 틱 칸에 들어가도록)
+        TimerEntry expired;
+        ListMoveAll( &wheel->slots[0][index], &expired );
+
+        wheel->current++;
+
+        while( !ListEmpty( &expired ) )
+        {
+            TimerEntry* entry = expired.next;
+
+            ListUnlink( entry );
+            wheel->count--;
+
+            entry->callback( entry->arg );
+            fired++;
+        }
+    }
+
+    return fired;
+}
+
+int TimerWheel_NextTimeout( TimerWheel* wheel, uint64_t now_ms )
+{
+    if( !wheel || wheel->count == 0 )
+        return -1;
+
+    // 처리하지 못한 틱이 남아있음
+    if( TickOf( wheel, now_ms ) >= wheel->current )
+        return 0;
+
+    // 단계 0 에서 가장 가까운 타이머, 없으면 다음 Cascade 시점까지
+    // (current 자체가 Cascade 시점이면 상위 단계 칸이 아직 내려오지 않았으므로 그 틱에서 멈춘다)
+    uint64_t tick = wheel->current;
+
+    for( int i = 0; i < WHEEL_SIZE; ++i, ++tick )
+    {
+        if( ( tick & WHEEL_MASK ) == 0 )
+            break;
+
+        if( !ListEmpty( &wheel->slots[0][tick & WHEEL_MASK] ) )
+            break;
+    }
+
+    uint64_t at = wheel->base_ms + tick * (uint64_t)wheel->tick_ms;
+    uint64_t ms = ( at > now_ms ) ? at - now_ms : 0;
+
+    return ( ms > 0x7fffffff ) ? 0x7fffffff : (int)ms;
+}
+
+int TimerWheel_Count( TimerWheel* wheel )
+{
+    return wheel ? wheel->count : 0;
+}